@@ -0,0 +1,304 @@
+#include <benchmark/benchmark.h>
+
+#include <components/compiler/context.hpp>
+#include <components/compiler/extensions.hpp>
+#include <components/compiler/extensions0.hpp>
+#include <components/compiler/fileparser.hpp>
+#include <components/compiler/locals.hpp>
+#include <components/compiler/scanner.hpp>
+#include <components/compiler/streamerrorhandler.hpp>
+#include <components/interpreter/context.hpp>
+#include <components/interpreter/installopcodes.hpp>
+#include <components/interpreter/interpreter.hpp>
+#include <components/misc/strings/algorithm.hpp>
+
+#include "apps/openmw/mwscript/localindexcache.hpp"
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    const std::string script = R"mwscript(Begin benchmark
+short i
+long sum
+float value
+
+set i to 0
+set sum to 0
+set value to 0
+while ( i < 100 )
+    set sum to ( sum + i * 3 )
+    if ( sum > 1000 )
+        set sum to ( sum - 1000 )
+    endif
+    set value to ( value + 0.5 )
+    set i to ( i + 1 )
+endwhile
+
+End)mwscript";
+
+    const std::string memberScript = R"mwscript(Begin member_benchmark
+short i
+float sum
+
+set i to 0
+set sum to 0
+while ( i < 100 )
+    set sum to ( sum + other.value )
+    set other.counter to ( other.counter + 1 )
+    set i to ( i + 1 )
+endwhile
+
+End)mwscript";
+
+    const std::string otherScriptId = "other_script";
+
+    // Declarations of the script accessed by memberScript, accessed variables are declared last
+    Compiler::Locals makeOtherLocals()
+    {
+        Compiler::Locals result;
+        for (int i = 0; i < 16; ++i)
+        {
+            result.declare('s', "short" + std::to_string(i));
+            result.declare('f', "float" + std::to_string(i));
+        }
+        result.declare('s', "counter");
+        result.declare('f', "value");
+        return result;
+    }
+
+    class CompilerContext : public Compiler::Context
+    {
+    public:
+        bool canDeclareLocals() const override { return true; }
+
+        char getGlobalType(const std::string& /*name*/) const override { return ' '; }
+
+        std::pair<char, bool> getMemberType(const std::string& name, const std::string& id) const override
+        {
+            if (id != "other")
+                return {' ', false};
+            return {mOtherLocals.getType(name), true};
+        }
+
+        bool isId(const std::string& name) const override { return name == "other"; }
+
+    private:
+        const Compiler::Locals mOtherLocals = makeOtherLocals();
+    };
+
+    class InterpreterContext : public Interpreter::Context
+    {
+    public:
+        std::vector<int> mShorts = std::vector<int>(1);
+        std::vector<int> mLongs = std::vector<int>(1);
+        std::vector<float> mFloats = std::vector<float>(1);
+
+        std::string_view getTarget() const override { return {}; }
+
+        int getLocalShort(int index) const override { return mShorts[index]; }
+
+        int getLocalLong(int index) const override { return mLongs[index]; }
+
+        float getLocalFloat(int index) const override { return mFloats[index]; }
+
+        void setLocalShort(int index, int value) override { mShorts[index] = value; }
+
+        void setLocalLong(int index, int value) override { mLongs[index] = value; }
+
+        void setLocalFloat(int index, float value) override { mFloats[index] = value; }
+
+        void messageBox(const std::string& /*message*/, const std::vector<std::string>& /*buttons*/) override {}
+
+        void report(const std::string& /*message*/) override {}
+
+        int getGlobalShort(std::string_view /*name*/) const override { return {}; }
+
+        int getGlobalLong(std::string_view /*name*/) const override { return {}; }
+
+        float getGlobalFloat(std::string_view /*name*/) const override { return {}; }
+
+        void setGlobalShort(std::string_view /*name*/, int /*value*/) override {}
+
+        void setGlobalLong(std::string_view /*name*/, int /*value*/) override {}
+
+        void setGlobalFloat(std::string_view /*name*/, float /*value*/) override {}
+
+        std::vector<std::string> getGlobals() const override { return {}; }
+
+        char getGlobalType(std::string_view /*name*/) const override { return ' '; }
+
+        std::string getActionBinding(std::string_view /*action*/) const override { return {}; }
+
+        std::string_view getActorName() const override { return {}; }
+
+        std::string_view getNPCRace() const override { return {}; }
+
+        std::string_view getNPCClass() const override { return {}; }
+
+        std::string_view getNPCFaction() const override { return {}; }
+
+        std::string_view getNPCRank() const override { return {}; }
+
+        std::string_view getPCName() const override { return {}; }
+
+        std::string_view getPCRace() const override { return {}; }
+
+        std::string_view getPCClass() const override { return {}; }
+
+        std::string_view getPCRank() const override { return {}; }
+
+        std::string_view getPCNextRank() const override { return {}; }
+
+        int getPCBounty() const override { return {}; }
+
+        std::string_view getCurrentCellName() const override { return {}; }
+
+        int getMemberShort(std::string_view /*id*/, std::string_view name, bool /*global*/,
+            Interpreter::MemberSlot* slot) const override
+        {
+            return mMemberShorts[getMemberIndex(name, 's', slot)];
+        }
+
+        int getMemberLong(std::string_view /*id*/, std::string_view /*name*/, bool /*global*/,
+            Interpreter::MemberSlot* /*slot*/) const override
+        {
+            return {};
+        }
+
+        float getMemberFloat(std::string_view /*id*/, std::string_view name, bool /*global*/,
+            Interpreter::MemberSlot* slot) const override
+        {
+            return mMemberFloats[getMemberIndex(name, 'f', slot)];
+        }
+
+        void setMemberShort(std::string_view /*id*/, std::string_view name, int value, bool /*global*/,
+            Interpreter::MemberSlot* slot) override
+        {
+            mMemberShorts[getMemberIndex(name, 's', slot)] = value;
+        }
+
+        void setMemberLong(std::string_view /*id*/, std::string_view /*name*/, int /*value*/, bool /*global*/,
+            Interpreter::MemberSlot* /*slot*/) override {}
+
+        void setMemberFloat(std::string_view /*id*/, std::string_view name, float value, bool /*global*/,
+            Interpreter::MemberSlot* slot) override
+        {
+            mMemberFloats[getMemberIndex(name, 'f', slot)] = value;
+        }
+
+        bool mUseMemberSlots = true;
+        std::vector<int> mMemberShorts = std::vector<int>(17);
+        std::vector<float> mMemberFloats = std::vector<float>(17);
+
+    private:
+        // Resolves indices the same way as MWScript::InterpreterContext with locals looked up by script id
+        std::unordered_map<std::string, Compiler::Locals, Misc::StringUtils::CiHash, Misc::StringUtils::CiEqual>
+            mScriptLocals {{"some_script", Compiler::Locals()}, {otherScriptId, makeOtherLocals()}};
+        MWScript::LocalIndexCache mLocalIndices;
+
+        int getMemberIndex(std::string_view name, char type, Interpreter::MemberSlot* slot) const
+        {
+            return mLocalIndices.get(otherScriptId, name, type, mUseMemberSlots ? slot : nullptr,
+                [&] () -> const Compiler::Locals& { return mScriptLocals.find(otherScriptId)->second; });
+        }
+    };
+
+    std::vector<Interpreter::Type_Code> compile(const std::string& text)
+    {
+        Compiler::Extensions extensions;
+        Compiler::registerExtensions(extensions);
+        CompilerContext context;
+        context.setExtensions(&extensions);
+        Compiler::StreamErrorHandler errorHandler;
+        Compiler::FileParser parser(errorHandler, context);
+        std::istringstream input(text);
+        Compiler::Scanner scanner(errorHandler, input, context.getExtensions());
+        scanner.scan(parser);
+        if (!errorHandler.isGood())
+            throw std::runtime_error("Failed to compile benchmark script");
+        std::vector<Interpreter::Type_Code> code;
+        parser.getCode(code);
+        return code;
+    }
+
+    void runCode(benchmark::State& state)
+    {
+        const std::vector<Interpreter::Type_Code> code = compile(script);
+        Interpreter::Interpreter interpreter;
+        Interpreter::installOpcodes(interpreter);
+        InterpreterContext context;
+
+        for (auto _ : state)
+        {
+            interpreter.run(code.data(), static_cast<int>(code.size()), context);
+            benchmark::DoNotOptimize(context.mLongs);
+        }
+    }
+
+    void runProgram(benchmark::State& state)
+    {
+        const std::vector<Interpreter::Type_Code> code = compile(script);
+        Interpreter::Interpreter interpreter;
+        Interpreter::installOpcodes(interpreter);
+        const Interpreter::Program program = interpreter.prepare(code.data(), static_cast<int>(code.size()));
+        InterpreterContext context;
+
+        for (auto _ : state)
+        {
+            interpreter.run(code.data(), static_cast<int>(code.size()), program, context);
+            benchmark::DoNotOptimize(context.mLongs);
+        }
+    }
+
+    void runMemberAccess(benchmark::State& state, bool useMemberSlots)
+    {
+        const std::vector<Interpreter::Type_Code> code = compile(memberScript);
+        Interpreter::Interpreter interpreter;
+        Interpreter::installOpcodes(interpreter);
+        const Interpreter::Program program = interpreter.prepare(code.data(), static_cast<int>(code.size()));
+        InterpreterContext context;
+        context.mUseMemberSlots = useMemberSlots;
+
+        for (auto _ : state)
+        {
+            interpreter.run(code.data(), static_cast<int>(code.size()), program, context);
+            benchmark::DoNotOptimize(context.mMemberShorts);
+        }
+    }
+
+    void runMemberAccessWithoutSlots(benchmark::State& state)
+    {
+        runMemberAccess(state, false);
+    }
+
+    void runMemberAccessWithSlots(benchmark::State& state)
+    {
+        runMemberAccess(state, true);
+    }
+
+    void prepareProgram(benchmark::State& state)
+    {
+        const std::vector<Interpreter::Type_Code> code = compile(script);
+        Interpreter::Interpreter interpreter;
+        Interpreter::installOpcodes(interpreter);
+
+        for (auto _ : state)
+        {
+            Interpreter::Program program = interpreter.prepare(code.data(), static_cast<int>(code.size()));
+            benchmark::DoNotOptimize(program);
+        }
+    }
+} // namespace
+
+BENCHMARK(runCode);
+BENCHMARK(runProgram);
+BENCHMARK(runMemberAccessWithoutSlots);
+BENCHMARK(runMemberAccessWithSlots);
+BENCHMARK(prepareProgram);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <components/misc/spatialgrid.hpp>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // Radii used by MWMechanics::Actors queries: collision avoidance, head tracking and default processing range
+    constexpr int collisionRadius = 200;
+    constexpr int headTrackingRadius = 400;
+    constexpr int processingRange = 7168;
+    // Actors of a crowded exterior are spread over a few cells around the player
+    constexpr float areaSize = 3 * 8192;
+
+    std::vector<osg::Vec3f> makeActors(std::size_t count)
+    {
+        std::minstd_rand random;
+        std::uniform_real_distribution<float> distribution(-areaSize / 2, areaSize / 2);
+        std::vector<osg::Vec3f> result;
+        for (std::size_t i = 0; i < count; ++i)
+            result.emplace_back(distribution(random), distribution(random), 0);
+        return result;
+    }
+
+    // Every actor looks for its neighbours once per frame
+    template <class Query>
+    std::size_t simulateFrame(const std::vector<osg::Vec3f>& actors, float radius, Query&& query)
+    {
+        std::size_t found = 0;
+        const auto count = [&] (std::size_t) { ++found; };
+        for (const osg::Vec3f& actor : actors)
+            query(actor, radius, count);
+        return found;
+    }
+
+    void linearScanFrame(benchmark::State& state)
+    {
+        const std::vector<osg::Vec3f> actors = makeActors(static_cast<std::size_t>(state.range(0)));
+        const float radius = static_cast<float>(state.range(1));
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(simulateFrame(actors, radius, [&] (const osg::Vec3f& position, float queryRadius, auto&& function)
+            {
+                for (std::size_t i = 0; i < actors.size(); ++i)
+                    if ((actors[i] - position).length2() <= queryRadius * queryRadius)
+                        function(i);
+            }));
+        }
+    }
+
+    void spatialGridFrame(benchmark::State& state)
+    {
+        const std::vector<osg::Vec3f> actors = makeActors(static_cast<std::size_t>(state.range(0)));
+        const float radius = static_cast<float>(state.range(1));
+        Misc::SpatialGrid<std::size_t> grid(512);
+        for (auto _ : state)
+        {
+            grid.clear();
+            for (std::size_t i = 0; i < actors.size(); ++i)
+                grid.add(actors[i], i);
+            grid.build();
+            benchmark::DoNotOptimize(simulateFrame(actors, radius, [&] (const osg::Vec3f& position, float queryRadius, auto&& function)
+            {
+                grid.forEachInRange(position, queryRadius, function);
+            }));
+        }
+    }
+
+    void setArguments(benchmark::internal::Benchmark* benchmark)
+    {
+        for (int count : {50, 300, 1000})
+            for (int radius : {collisionRadius, headTrackingRadius, processingRange})
+                benchmark->Args({count, radius});
+    }
+}
+
+BENCHMARK(linearScanFrame)->Apply(setArguments);
+BENCHMARK(spatialGridFrame)->Apply(setArguments);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <components/sceneutil/skinning.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t verticesCount = 4096;
+    constexpr std::size_t groupSize = 16;
+
+    struct Mesh
+    {
+        std::vector<float> mPositions;
+        std::vector<float> mNormals;
+        std::vector<float> mTangents;
+        std::vector<float> mSkinnedPositions;
+        std::vector<float> mSkinnedNormals;
+        std::vector<float> mSkinnedTangents;
+        // Vertices of influence groups are scattered over the mesh as in real models
+        std::vector<unsigned short> mIndices;
+        std::vector<std::array<float, 16>> mMatrices;
+    };
+
+    Mesh makeMesh()
+    {
+        std::minstd_rand random;
+        std::uniform_real_distribution<float> distribution(-1, 1);
+        const auto generate = [&] (std::size_t size)
+        {
+            std::vector<float> result(size);
+            std::generate(result.begin(), result.end(), [&] { return distribution(random); });
+            return result;
+        };
+
+        Mesh mesh;
+        mesh.mPositions = generate(verticesCount * 3);
+        mesh.mNormals = generate(verticesCount * 3);
+        mesh.mTangents = generate(verticesCount * 4);
+        mesh.mSkinnedPositions.resize(mesh.mPositions.size());
+        mesh.mSkinnedNormals.resize(mesh.mNormals.size());
+        mesh.mSkinnedTangents.resize(mesh.mTangents.size());
+        mesh.mIndices.resize(verticesCount);
+        std::iota(mesh.mIndices.begin(), mesh.mIndices.end(), 0);
+        std::shuffle(mesh.mIndices.begin(), mesh.mIndices.end(), random);
+        for (std::size_t i = 0; i < verticesCount / groupSize; ++i)
+        {
+            std::array<float, 16> matrix;
+            std::generate(matrix.begin(), matrix.end(), [&] { return distribution(random); });
+            matrix[3] = matrix[7] = matrix[11] = 0;
+            matrix[15] = 1;
+            mesh.mMatrices.push_back(matrix);
+        }
+        return mesh;
+    }
+
+    void skinMesh(benchmark::State& state, Mesh& mesh, const SceneUtil::SkinningArrays& arrays)
+    {
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < mesh.mMatrices.size(); ++i)
+                SceneUtil::skinVertices(mesh.mMatrices[i].data(), mesh.mIndices.data() + i * groupSize, groupSize, arrays);
+            benchmark::ClobberMemory();
+        }
+        // Reported as items_per_second, divide by 1000 to get skinned vertices per millisecond
+        state.SetItemsProcessed(state.iterations() * verticesCount);
+    }
+
+    void skinPositions(benchmark::State& state)
+    {
+        Mesh mesh = makeMesh();
+        SceneUtil::SkinningArrays arrays;
+        arrays.mPositionSrc = mesh.mPositions.data();
+        arrays.mPositionDst = mesh.mSkinnedPositions.data();
+        skinMesh(state, mesh, arrays);
+    }
+
+    void skinPositionsNormalsAndTangents(benchmark::State& state)
+    {
+        Mesh mesh = makeMesh();
+        SceneUtil::SkinningArrays arrays;
+        arrays.mPositionSrc = mesh.mPositions.data();
+        arrays.mPositionDst = mesh.mSkinnedPositions.data();
+        arrays.mNormalSrc = mesh.mNormals.data();
+        arrays.mNormalDst = mesh.mSkinnedNormals.data();
+        arrays.mTangentSrc = mesh.mTangents.data();
+        arrays.mTangentDst = mesh.mSkinnedTangents.data();
+        skinMesh(state, mesh, arrays);
+    }
+}
+
+BENCHMARK(skinPositions);
+BENCHMARK(skinPositionsNormalsAndTangents);
+
+BENCHMARK_MAIN();
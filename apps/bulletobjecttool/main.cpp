@@ -22,6 +22,7 @@
 
 #include <charconv>
 #include <cstddef>
+#include <filesystem>
 #include <iomanip>
 #include <stdexcept>
 #include <string>
@@ -72,6 +73,10 @@ namespace
 
             ("fallback", bpo::value<FallbackMap>()->default_value(FallbackMap(), "")
                 ->multitoken()->composing(), "fallback values")
+
+            ("write-shape-cache", bpo::value<bool>()->implicit_value(true)
+                ->default_value(false), "store loaded collision shapes in the cache directory used by the engine"
+                " when 'cache collision shapes' setting is enabled")
         ;
 
         Files::ConfigurationManager::addCommonOptions(result);
@@ -177,6 +182,9 @@ namespace
         Resource::SceneManager sceneManager(&vfs, &imageManager, &nifFileManager);
         Resource::BulletShapeManager bulletShapeManager(&vfs, &sceneManager, &nifFileManager);
 
+        if (variables["write-shape-cache"].as<bool>())
+            bulletShapeManager.setDiskCachePath(std::filesystem::path(config.getCachePath().string()) / "shapes");
+
         Resource::forEachBulletObject(readers, vfs, bulletShapeManager, esmData,
             [] (const ESM::Cell& cell, const Resource::BulletObject& object)
             {
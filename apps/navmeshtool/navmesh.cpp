@@ -34,6 +34,7 @@ namespace NavMeshTool
     namespace
     {
         using DetourNavigator::AgentBounds;
+        using DetourNavigator::DictionaryId;
         using DetourNavigator::GenerateNavMeshTile;
         using DetourNavigator::NavMeshDb;
         using DetourNavigator::NavMeshTileInfo;
@@ -101,6 +102,12 @@ namespace NavMeshTool
                 return mDeleted;
             }
 
+            std::size_t getCommits() const
+            {
+                const std::lock_guard lock(mMutex);
+                return mCommits;
+            }
+
             std::int64_t resolveMeshSource(const MeshSource& source) override
             {
                 const std::lock_guard lock(mMutex);
@@ -193,6 +200,7 @@ namespace NavMeshTool
                     if (now - start > transactionInterval)
                     {
                         mTransaction.commit();
+                        ++mCommits;
                         mTransaction = mDb.startTransaction(Sqlite3::TransactionMode::Immediate);
                         start = now;
                     }
@@ -207,6 +215,27 @@ namespace NavMeshTool
             {
                 const std::lock_guard lock(mMutex);
                 mTransaction.commit();
+                ++mCommits;
+            }
+
+            std::size_t recompress()
+            {
+                constexpr std::size_t dictionarySamples = 256;
+                const std::lock_guard lock(mMutex);
+                Transaction transaction = mDb.startTransaction(Sqlite3::TransactionMode::Immediate);
+                if (mDb.getDictionaryId() == 0)
+                {
+                    Log(Debug::Info) << "Making compression dictionary for navmesh tiles...";
+                    const DictionaryId dictionaryId = mDb.makeDictionary(dictionarySamples);
+                    if (dictionaryId == 0)
+                        return 0;
+                }
+                Log(Debug::Info) << "Recompressing navmesh tiles with dictionary " << static_cast<std::int64_t>(mDb.getDictionaryId()) << "...";
+                const std::size_t result = mDb.recompressTiles();
+                transaction.commit();
+                ++mCommits;
+                Log(Debug::Info) << "Recompressed " << result << " navmesh tiles";
+                return result;
             }
 
             void vacuum()
@@ -219,6 +248,7 @@ namespace NavMeshTool
             {
                 const std::lock_guard lock(mMutex);
                 mTransaction.commit();
+                ++mCommits;
                 Log(Debug::Info) << "Removing tiles outside processed range for worldspace \"" << worldspace << "\"...";
                 mDeleted += static_cast<std::size_t>(mDb.deleteTilesOutsideRange(worldspace, range));
                 mTransaction = mDb.startTransaction(Sqlite3::TransactionMode::Immediate);
@@ -229,6 +259,7 @@ namespace NavMeshTool
             std::atomic_size_t mInserted {0};
             std::atomic_size_t mUpdated {0};
             std::size_t mDeleted = 0;
+            std::size_t mCommits = 0;
             Status mStatus = Status::Ok;
             mutable std::mutex mMutex;
             NavMeshDb mDb;
@@ -258,6 +289,8 @@ namespace NavMeshTool
     {
         Log(Debug::Info) << "Generating navmesh tiles by " << threadsNumber << " parallel workers...";
 
+        const auto start = std::chrono::steady_clock::now();
+
         SceneUtil::WorkQueue workQueue(threadsNumber);
         auto navMeshTileConsumer = std::make_shared<NavMeshTileConsumer>(std::move(db), removeUnusedTiles, writeBinaryLog);
         std::size_t tiles = 0;
@@ -312,7 +345,17 @@ namespace NavMeshTool
             << updated << " updated and "
             << deleted << " deleted";
 
-        if (inserted + updated + deleted > 0)
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (elapsed > 0)
+            Log(Debug::Info) << "Written " << inserted + updated << " navmesh tiles using "
+                << navMeshTileConsumer->getCommits() << " transactions in " << elapsed << " seconds ("
+                << static_cast<double>(inserted + updated) / elapsed << " tiles/s)";
+
+        std::size_t recompressed = 0;
+        if (status == Status::Ok)
+            recompressed = navMeshTileConsumer->recompress();
+
+        if (inserted + updated + deleted + recompressed > 0)
         {
             Log(Debug::Info) << "Vacuuming the database...";
             navMeshTileConsumer->vacuum();
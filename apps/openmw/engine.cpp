@@ -19,6 +19,7 @@
 
 #include <components/vfs/manager.hpp>
 #include <components/vfs/registerarchives.hpp>
+#include <components/bsa/decompressedfilecache.hpp>
 
 #include <components/sdlutil/sdlgraphicswindow.hpp>
 #include <components/sdlutil/imagetosurface.hpp>
@@ -438,6 +439,14 @@ bool OMW::Engine::frame(float frametime)
 
             mResourceSystem->reportStats(frameNumber, stats);
 
+            if (mDecompressedFileCache != nullptr)
+            {
+                const Bsa::DecompressedFileCache::Stats archiveCacheStats = mDecompressedFileCache->getStats();
+                stats->setAttribute(frameNumber, "Archive Cache Size", archiveCacheStats.mSize);
+                stats->setAttribute(frameNumber, "Archive Cache Hits", archiveCacheStats.mHits);
+                stats->setAttribute(frameNumber, "Archive Cache Misses", archiveCacheStats.mMisses);
+            }
+
             stats->setAttribute(frameNumber, "WorkQueue", mWorkQueue->getNumItems());
             stats->setAttribute(frameNumber, "WorkThread", mWorkQueue->getNumActiveThreads());
 
@@ -748,7 +757,20 @@ void OMW::Engine::prepareEngine()
 
     mVFS = std::make_unique<VFS::Manager>(mFSStrict);
 
-    VFS::registerArchives(mVFS.get(), mFileCollections, mArchives, true);
+    std::filesystem::path vfsIndexCacheDir;
+    if (Settings::Manager::getBool("cache data directory listings", "General"))
+        vfsIndexCacheDir = std::filesystem::path(mCfgMgr.getCachePath().string()) / "vfs";
+
+    const int decompressedCacheSize = Settings::Manager::getInt("decompressed archive cache size", "General");
+    if (decompressedCacheSize < 0)
+        throw std::runtime_error("Invalid setting: 'decompressed archive cache size' must be >=0");
+
+    if (decompressedCacheSize > 0)
+        mDecompressedFileCache = std::make_shared<Bsa::DecompressedFileCache>(
+            static_cast<std::size_t>(decompressedCacheSize) * 1024 * 1024);
+
+    VFS::registerArchives(mVFS.get(), mFileCollections, mArchives, true,
+        Settings::Manager::getBool("memory mapped archives", "General"), vfsIndexCacheDir, mDecompressedFileCache);
 
     mResourceSystem = std::make_unique<Resource::ResourceSystem>(mVFS.get());
     mResourceSystem->getSceneManager()->getShaderManager().setMaxTextureUnits(mGlMaxTextureImageUnits);
@@ -759,6 +781,11 @@ void OMW::Engine::prepareEngine()
         Settings::Manager::getString("texture mipmap", "General"),
         Settings::Manager::getInt("anisotropy", "General")
     );
+    const std::filesystem::path cachePath(mCfgMgr.getCachePath().string());
+    if (Settings::Manager::getBool("cache converted models", "Models"))
+        mResourceSystem->getSceneManager()->setTemplateDiskCachePath(cachePath / "models");
+    if (Settings::Manager::getBool("cache collision shapes", "Physics"))
+        mResourceSystem->setShapeDiskCachePath(cachePath / "shapes");
     mEnvironment.setResourceSystem(*mResourceSystem);
 
     int numThreads = Settings::Manager::getInt("preload num threads", "Cells");
@@ -30,6 +30,11 @@ namespace VFS
     class Manager;
 }
 
+namespace Bsa
+{
+    class DecompressedFileCache;
+}
+
 namespace Compiler
 {
     class Context;
@@ -119,6 +124,7 @@ namespace OMW
     {
             SDL_Window* mWindow;
             std::unique_ptr<VFS::Manager> mVFS;
+            std::shared_ptr<Bsa::DecompressedFileCache> mDecompressedFileCache;
             std::unique_ptr<Resource::ResourceSystem> mResourceSystem;
             osg::ref_ptr<SceneUtil::WorkQueue> mWorkQueue;
             std::unique_ptr<SceneUtil::UnrefQueue> mUnrefQueue;
@@ -6,6 +6,7 @@
 namespace Interpreter
 {
     class Context;
+    struct MemberSlot;
 }
 
 namespace Compiler
@@ -52,6 +53,12 @@ namespace MWBase
             virtual const Compiler::Locals& getLocals(std::string_view name) = 0;
             ///< Return locals for script \a name.
 
+            virtual int getLocalIndex(std::string_view scriptId, std::string_view name, char type,
+                Interpreter::MemberSlot* slot) = 0;
+            ///< Return index of local variable \a name of type \a type in script \a scriptId
+            /// (-1: does not exist). The index is kept in \a slot of the accessing call site (may be nullptr)
+            /// until locals of any script change.
+
             virtual MWScript::GlobalScripts& getGlobalScripts() = 0;
 
             virtual const Compiler::Extensions& getExtensions() const = 0;
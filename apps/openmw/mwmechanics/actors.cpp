@@ -1,5 +1,6 @@
 #include "actors.hpp"
 
+#include <algorithm>
 #include <optional>
 
 #include <components/esm3/esmreader.hpp>
@@ -243,6 +244,19 @@ namespace MWMechanics
             return (distanceToNextPathPoint - package.getNextPathPointTolerance(speed, duration, halfExtents)) / speed;
         }
 
+        float getMaxHeadTrackDistance(const MWWorld::Ptr& actor)
+        {
+            static const float fMaxHeadTrackDistance = MWBase::Environment::get().getWorld()->getStore()
+                .get<ESM::GameSetting>().find("fMaxHeadTrackDistance")->mValue.getFloat();
+            static const float fInteriorHeadTrackMult = MWBase::Environment::get().getWorld()->getStore()
+                .get<ESM::GameSetting>().find("fInteriorHeadTrackMult")->mValue.getFloat();
+            float maxDistance = fMaxHeadTrackDistance;
+            const ESM::Cell* currentCell = actor.getCell()->getCell();
+            if (!currentCell->isExterior() && !(currentCell->mData.mFlags & ESM::Cell::QuasiEx))
+                maxDistance *= fInteriorHeadTrackMult;
+            return maxDistance;
+        }
+
         void updateHeadTracking(const MWWorld::Ptr& actor, const MWWorld::Ptr& targetActor,
             MWWorld::Ptr& headTrackTarget, float& sqrHeadTrackDistance, bool inCombatOrPursue)
         {
@@ -256,14 +270,7 @@ namespace MWMechanics
             if (isTargetMagicallyHidden(targetActor))
                 return;
 
-            static const float fMaxHeadTrackDistance = MWBase::Environment::get().getWorld()->getStore()
-                .get<ESM::GameSetting>().find("fMaxHeadTrackDistance")->mValue.getFloat();
-            static const float fInteriorHeadTrackMult = MWBase::Environment::get().getWorld()->getStore()
-                .get<ESM::GameSetting>().find("fInteriorHeadTrackMult")->mValue.getFloat();
-            float maxDistance = fMaxHeadTrackDistance;
-            const ESM::Cell* currentCell = actor.getCell()->getCell();
-            if (!currentCell->isExterior() && !(currentCell->mData.mFlags & ESM::Cell::QuasiEx))
-                maxDistance *= fInteriorHeadTrackMult;
+            const float maxDistance = getMaxHeadTrackDistance(actor);
 
             const osg::Vec3f actor1Pos(actorRefData.getPosition().asVec3());
             const osg::Vec3f actor2Pos(targetActor.getRefData().getPosition().asVec3());
@@ -287,7 +294,7 @@ namespace MWMechanics
             }
         }
 
-        void updateHeadTracking(const MWWorld::Ptr& ptr, const std::list<Actor>& actors, bool isPlayer, CharacterController& ctrl)
+        void updateHeadTracking(const MWWorld::Ptr& ptr, const Actors& actors, bool isPlayer, CharacterController& ctrl)
         {
             float sqrHeadTrackDistance = std::numeric_limits<float>::max();
             MWWorld::Ptr headTrackTarget;
@@ -313,12 +320,15 @@ namespace MWMechanics
                 else
                 {
                     // Find something nearby.
-                    for (const Actor& otherActor : actors)
+                    std::vector<MWWorld::Ptr> neighbors;
+                    actors.getObjectsInRange(ptr.getRefData().getPosition().asVec3(), getMaxHeadTrackDistance(ptr),
+                        neighbors);
+                    for (const MWWorld::Ptr& neighbor : neighbors)
                     {
-                        if (otherActor.getPtr() == ptr)
+                        if (neighbor == ptr)
                             continue;
 
-                        updateHeadTracking(ptr, otherActor.getPtr(), headTrackTarget, sqrHeadTrackDistance, inCombatOrPursue);
+                        updateHeadTracking(ptr, neighbor, headTrackTarget, sqrHeadTrackDistance, inCombatOrPursue);
                     }
                 }
             }
@@ -326,6 +336,31 @@ namespace MWMechanics
             ctrl.setHeadTrackTarget(headTrackTarget);
         }
 
+        /// Fatigue after restoration for the given time or nothing when it should not change. Reads only the given
+        /// stats, so it's safe to call for different actors from multiple threads.
+        std::optional<DynamicStat<float>> getRestoredFatigue(const CreatureStats& stats, float duration)
+        {
+            if (stats.isDead())
+                return {};
+
+            // Current fatigue can be above base value due to a fortify effect.
+            // In that case stop here and don't try to restore.
+            DynamicStat<float> fatigue = stats.getFatigue();
+            if (fatigue.getCurrent() >= fatigue.getBase())
+                return {};
+
+            // Restore fatigue
+            const float endurance = stats.getAttribute(ESM::Attribute::Endurance).getModified();
+            const MWWorld::Store<ESM::GameSetting>& settings = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
+            static const float fFatigueReturnBase = settings.find("fFatigueReturnBase")->mValue.getFloat ();
+            static const float fFatigueReturnMult = settings.find("fFatigueReturnMult")->mValue.getFloat ();
+
+            const float x = fFatigueReturnBase + fFatigueReturnMult * endurance;
+
+            fatigue.setCurrent (fatigue.getCurrent() + duration * x);
+            return fatigue;
+        }
+
         void updateLuaControls(const MWWorld::Ptr& ptr, bool isPlayer, MWBase::LuaManager::ActorControls& controls)
         {
             Movement& mov = ptr.getClass().getMovementSettings(ptr);
@@ -831,27 +866,25 @@ namespace MWMechanics
 
     void Actors::calculateRestoration(const MWWorld::Ptr& ptr, float duration) const
     {
-        if (ptr.getClass().getCreatureStats(ptr).isDead())
-            return;
-
         MWMechanics::CreatureStats& stats = ptr.getClass().getCreatureStats (ptr);
+        if (const std::optional<DynamicStat<float>> fatigue = getRestoredFatigue(stats, duration))
+            stats.setFatigue (*fatigue);
+    }
 
-        // Current fatigue can be above base value due to a fortify effect.
-        // In that case stop here and don't try to restore.
-        DynamicStat<float> fatigue = stats.getFatigue();
-        if (fatigue.getCurrent() >= fatigue.getBase())
-            return;
-
-        // Restore fatigue
-        const float endurance = stats.getAttribute(ESM::Attribute::Endurance).getModified();
-        const MWWorld::Store<ESM::GameSetting>& settings = MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>();
-        static const float fFatigueReturnBase = settings.find("fFatigueReturnBase")->mValue.getFloat ();
-        static const float fFatigueReturnMult = settings.find("fFatigueReturnMult")->mValue.getFloat ();
+    void Actors::calculateRestorations(float duration)
+    {
+        // Each worker writes only the fatigue of its own entry. Results are applied in the actors order.
+        mUpdateWorkers.parallelFor(mFatigueRestorations.size(), [&] (std::size_t i)
+        {
+            FatigueRestoration& restoration = mFatigueRestorations[i];
+            restoration.mFatigue = getRestoredFatigue(*restoration.mStats, duration);
+        });
 
-        const float x = fFatigueReturnBase + fFatigueReturnMult * endurance;
+        for (const FatigueRestoration& restoration : mFatigueRestorations)
+            if (restoration.mFatigue.has_value())
+                restoration.mStats->setFatigue(*restoration.mFatigue);
 
-        fatigue.setCurrent (fatigue.getCurrent() + duration * x);
-        stats.setFatigue (fatigue);
+        mFatigueRestorations.clear();
     }
 
     bool Actors::isAttackPreparing(const MWWorld::Ptr& ptr) const
@@ -1099,7 +1132,9 @@ namespace MWMechanics
         }
     }
 
-    Actors::Actors() : mSmoothMovement(Settings::Manager::getBool("smooth movement", "Game"))
+    Actors::Actors()
+        : mSmoothMovement(Settings::Manager::getBool("smooth movement", "Game"))
+        , mUpdateWorkers(static_cast<std::size_t>(std::max(1, Settings::Manager::getInt("actors update threads", "Game"))))
     {
         mTimerDisposeSummonsCorpses = 0.2f; // We should add a delay between summoned creature death and its corpse despawning
 
@@ -1129,6 +1164,7 @@ namespace MWMechanics
             return;
         const auto it = mActors.emplace(mActors.end(), ptr, anim);
         mIndex.emplace(ptr.mRef, it);
+        mActorsGridDirty = true;
 
         if (updateImmediately)
             it->getCharacterController().update(0);
@@ -1179,6 +1215,7 @@ namespace MWMechanics
                 removeTemporaryEffects(iter->second->getPtr());
             mActors.erase(iter->second);
             mIndex.erase(iter);
+            mActorsGridDirty = true;
         }
     }
 
@@ -1225,7 +1262,16 @@ namespace MWMechanics
     {
         const auto iter = mIndex.find(old.mRef);
         if (iter != mIndex.end())
+        {
             iter->second->updatePtr(ptr);
+            mActorsGridDirty = true;
+        }
+    }
+
+    void Actors::updatePosition(const MWWorld::Ptr& ptr) const
+    {
+        if (!mActorsGridDirty && mIndex.find(ptr.mRef) != mIndex.end())
+            mActorsGridDirty = true;
     }
 
     void Actors::dropActors (const MWWorld::CellStore *cellStore, const MWWorld::Ptr& ignore)
@@ -1237,6 +1283,7 @@ namespace MWMechanics
                 removeTemporaryEffects(iter->getPtr());
                 mIndex.erase(iter->getPtr().mRef);
                 iter = mActors.erase(iter);
+                mActorsGridDirty = true;
             }
             else
                 ++iter;
@@ -1298,6 +1345,7 @@ namespace MWMechanics
 
         const MWWorld::Ptr player = getPlayer();
         const MWBase::World* const world = MWBase::Environment::get().getWorld();
+        std::vector<MWWorld::Ptr> neighbors;
         for (const Actor& actor : mActors)
         {
             const MWWorld::Ptr& ptr = actor.getPtr();
@@ -1359,10 +1407,11 @@ namespace MWMechanics
             osg::Vec2f movementCorrection(0, 0);
             float angleToApproachingActor = 0;
 
-            // Iterate through all other actors and predict collisions.
-            for (const Actor& otherActor : mActors)
+            // Iterate through all other actors close enough and predict collisions.
+            neighbors.clear();
+            getObjectsInRange(basePos, maxDistToCheck, neighbors);
+            for (const MWWorld::Ptr& otherPtr : neighbors)
             {
-                const MWWorld::Ptr& otherPtr = otherActor.getPtr();
                 if (otherPtr == ptr || otherPtr == currentTarget)
                     continue;
 
@@ -1436,6 +1485,9 @@ namespace MWMechanics
     {
         if(!paused)
         {
+            // Actors were moved by physics since the last update
+            mActorsGridDirty = true;
+
             const float updateEquippedLightInterval = 1.0f;
 
             if (mTimerUpdateHeadTrack >= 0.3f)
@@ -1471,6 +1523,8 @@ namespace MWMechanics
                     player.getClass().getCreatureStats(player).setHitAttemptActorId(-1);
             }
             const bool godmode = MWBase::Environment::get().getWorld()->getGodModeState();
+            std::vector<MWWorld::Ptr> neighbors;
+            mFatigueRestorations.clear();
 
              // AI and magic effects update
             for (Actor& actor : mActors)
@@ -1508,7 +1562,15 @@ namespace MWMechanics
                 {
                     const bool cellChanged = world->hasCellChanged();
                     const MWWorld::Ptr actorPtr = actor.getPtr(); // make a copy of the map key to avoid it being invalidated when the player teleports
-                    updateActor(actorPtr, duration);
+                    if (mUpdateWorkers.getThreadsCount() > 1)
+                    {
+                        // Fatigue is restored for all actors at once after the loop
+                        adjustMagicEffects(actorPtr, duration);
+                        mFatigueRestorations.push_back(FatigueRestoration {
+                            &actorPtr.getClass().getCreatureStats(actorPtr), std::nullopt});
+                    }
+                    else
+                        updateActor(actorPtr, duration);
 
                     // Looping magic VFX update
                     // Note: we need to do this before any of the animations are updated.
@@ -1529,15 +1591,23 @@ namespace MWMechanics
                             if (!isPlayer)
                                 adjustCommandedActor(actor.getPtr());
 
-                            for (const Actor& otherActor : mActors)
+                            // Player is not AI-controlled
+                            if (!isPlayer)
                             {
-                                if (otherActor.getPtr() == actor.getPtr() || isPlayer) // player is not AI-controlled
-                                    continue;
-                                engageCombat(actor.getPtr(), otherActor.getPtr(), cachedAllies, otherActor.getPtr() == player);
+                                // engageCombat ignores actors out of processing range
+                                neighbors.clear();
+                                getObjectsInRange(actor.getPtr().getRefData().getPosition().asVec3(),
+                                    mActorsProcessingRange, neighbors);
+                                for (const MWWorld::Ptr& neighbor : neighbors)
+                                {
+                                    if (neighbor == actor.getPtr())
+                                        continue;
+                                    engageCombat(actor.getPtr(), neighbor, cachedAllies, neighbor == player);
+                                }
                             }
                         }
                         if (mTimerUpdateHeadTrack == 0)
-                            updateHeadTracking(actor.getPtr(), mActors, isPlayer, ctrl);
+                            updateHeadTracking(actor.getPtr(), *this, isPlayer, ctrl);
 
                         if (actor.getPtr().getClass().isNpc() && !isPlayer)
                             updateCrimePursuit(actor.getPtr(), duration);
@@ -1573,6 +1643,8 @@ namespace MWMechanics
                 }
             }
 
+            calculateRestorations(duration);
+
             static const bool avoidCollisions = Settings::Manager::getBool("NPCs avoid collisions", "Game");
             if (avoidCollisions)
                 predictAndAvoidCollisions(duration);
@@ -1645,6 +1717,9 @@ namespace MWMechanics
                 playerCharacter->setVisibility(1.f);
             }
 
+            // Positions could be adjusted by the loop above
+            mActorsGridDirty = true;
+
             for (const Actor& actor : mActors)
             {
                 const MWWorld::Class &cls = actor.getPtr().getClass();
@@ -1972,24 +2047,36 @@ namespace MWMechanics
             actor.getCharacterController().persistAnimationState();
     }
 
-    void Actors::getObjectsInRange(const osg::Vec3f& position, float radius, std::vector<MWWorld::Ptr>& out) const
+    const Misc::SpatialGrid<std::size_t>& Actors::getActorsGrid() const
     {
-        for (const Actor& actor : mActors)
+        if (mActorsGridDirty)
         {
-            if ((actor.getPtr().getRefData().getPosition().asVec3() - position).length2() <= radius*radius)
-                out.push_back(actor.getPtr());
+            mActorsGrid.clear();
+            mActorsGridPtrs.clear();
+            for (const Actor& actor : mActors)
+            {
+                mActorsGrid.add(actor.getPtr().getRefData().getPosition().asVec3(), mActorsGridPtrs.size());
+                mActorsGridPtrs.push_back(actor.getPtr());
+            }
+            mActorsGrid.build();
+            mActorsGridDirty = false;
         }
+        return mActorsGrid;
     }
 
-    bool Actors::isAnyObjectInRange(const osg::Vec3f& position, float radius) const
+    void Actors::getObjectsInRange(const osg::Vec3f& position, float radius, std::vector<MWWorld::Ptr>& out) const
     {
-        for (const Actor& actor : mActors)
-        {
-            if ((actor.getPtr().getRefData().getPosition().asVec3() - position).length2() <= radius*radius)
-                return true;
-        }
+        std::vector<std::size_t> indices;
+        getActorsGrid().forEachInRange(position, radius, [&] (std::size_t index) { indices.push_back(index); });
+        // Callers like engageCombat depend on the order of mActors
+        std::sort(indices.begin(), indices.end());
+        for (const std::size_t index : indices)
+            out.push_back(mActorsGridPtrs[index]);
+    }
 
-        return false;
+    bool Actors::isAnyObjectInRange(const osg::Vec3f& position, float radius) const
+    {
+        return getActorsGrid().anyInRange(position, radius);
     }
 
     std::vector<MWWorld::Ptr> Actors::getActorsSidingWith(const MWWorld::Ptr& actorPtr, bool excludeInfighting) const
@@ -2205,6 +2292,7 @@ namespace MWMechanics
     {
         mIndex.clear();
         mActors.clear();
+        mActorsGridDirty = true;
         mDeathCount.clear();
     }
 
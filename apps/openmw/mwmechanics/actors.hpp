@@ -6,8 +6,13 @@
 #include <string>
 #include <list>
 #include <map>
+#include <optional>
+
+#include <components/misc/spatialgrid.hpp>
+#include <components/misc/workerpool.hpp>
 
 #include "actor.hpp"
+#include "stat.hpp"
 
 namespace ESM
 {
@@ -77,6 +82,9 @@ namespace MWMechanics
             void updateActor(const MWWorld::Ptr &old, const MWWorld::Ptr& ptr) const;
             ///< Updates an actor with a new Ptr
 
+            void updatePosition(const MWWorld::Ptr& ptr) const;
+            ///< Updates spatial queries with a new position of the actor
+
             void dropActors (const MWWorld::CellStore *cellStore, const MWWorld::Ptr& ignore);
             ///< Deregister all actors (except for \a ignore) in the given cell.
 
@@ -179,9 +187,20 @@ namespace MWMechanics
                 Battle
             };
 
+            struct FatigueRestoration
+            {
+                CreatureStats* mStats;
+                std::optional<DynamicStat<float>> mFatigue;
+            };
+
             std::map<std::string, int> mDeathCount;
             std::list<Actor> mActors;
             std::map<const MWWorld::LiveCellRefBase*, std::list<Actor>::iterator> mIndex;
+            // Indices of mActors in list order by position, rebuilt on first use after actors were added, removed
+            // or moved
+            mutable Misc::SpatialGrid<std::size_t> mActorsGrid {512.f};
+            mutable std::vector<MWWorld::Ptr> mActorsGridPtrs;
+            mutable bool mActorsGridDirty = true;
             float mTimerDisposeSummonsCorpses;
             float mTimerUpdateHeadTrack = 0;
             float mTimerUpdateEquippedLight = 0;
@@ -190,14 +209,22 @@ namespace MWMechanics
             float mSneakSkillTimer = 0; // Times sneak skill progress from "avoid notice"
             float mActorsProcessingRange;
             bool mSmoothMovement;
+            Misc::WorkerPool mUpdateWorkers;
+            // Fatigue of actors updated this frame, restored by mUpdateWorkers when there is more than one thread
+            std::vector<FatigueRestoration> mFatigueRestorations;
             MusicType mCurrentMusic = MusicType::Title;
 
+            const Misc::SpatialGrid<std::size_t>& getActorsGrid() const;
+
             void updateVisibility(const MWWorld::Ptr& ptr, CharacterController& ctrl) const;
 
             void adjustMagicEffects(const MWWorld::Ptr& creature, float duration) const;
 
             void calculateRestoration(const MWWorld::Ptr& ptr, float duration) const;
 
+            /// Restore fatigue of all actors from mFatigueRestorations in parallel and apply it in the actors order.
+            void calculateRestorations(float duration);
+
             void updateCrimePursuit(const MWWorld::Ptr& ptr, float duration) const;
 
             void killDeadActors ();
@@ -296,6 +296,12 @@ namespace MWMechanics
         mObjects.removeObject(ptr);
     }
 
+    void MechanicsManager::updatePosition(const MWWorld::Ptr& ptr)
+    {
+        if (ptr.getClass().isActor())
+            mActors.updatePosition(ptr);
+    }
+
     void MechanicsManager::updateCell(const MWWorld::Ptr &old, const MWWorld::Ptr &ptr)
     {
         if(old == MWBase::Environment::get().getWindowManager()->getWatchedActor())
@@ -0,0 +1,98 @@
+#include "collisionsnapshot.hpp"
+
+#include <utility>
+
+#include <BulletCollision/BroadphaseCollision/btBroadphaseInterface.h>
+#include <BulletCollision/CollisionDispatch/btCollisionObject.h>
+
+namespace MWPhysics
+{
+    namespace
+    {
+        template <class Function>
+        struct LeafVisitor final : btDbvt::ICollide
+        {
+            Function mFunction;
+
+            explicit LeafVisitor(Function&& function) : mFunction(std::move(function)) {}
+
+            using btDbvt::ICollide::Process;
+
+            void Process(const btDbvtNode* leaf) override
+            {
+                mFunction(leaf->data);
+            }
+        };
+    }
+
+    CollisionSnapshot::CollisionSnapshot(const btCollisionWorld& collisionWorld)
+    {
+        const btCollisionObjectArray& collisionObjects = collisionWorld.getCollisionObjectArray();
+        mObjects.reserve(static_cast<std::size_t>(collisionObjects.size()));
+        for (int i = 0; i < collisionObjects.size(); ++i)
+        {
+            const btCollisionObject* collisionObject = collisionObjects[i];
+            const btBroadphaseProxy* proxy = collisionObject->getBroadphaseHandle();
+            if (proxy == nullptr)
+                continue;
+            mObjects.push_back(Object {*proxy, collisionObject->getWorldTransform(), collisionObject->getCollisionShape()});
+        }
+        // Insert only once mObjects won't reallocate anymore, leaves point to its elements
+        for (Object& object : mObjects)
+            mTree.insert(btDbvtVolume::FromMM(object.mProxy.m_aabbMin, object.mProxy.m_aabbMax), &object);
+    }
+
+    void CollisionSnapshot::rayTest(const btVector3& rayFromWorld, const btVector3& rayToWorld, btCollisionWorld::RayResultCallback& resultCallback) const
+    {
+        if (mTree.m_root == nullptr)
+            return;
+        btTransform rayFromTrans;
+        rayFromTrans.setIdentity();
+        rayFromTrans.setOrigin(rayFromWorld);
+        btTransform rayToTrans;
+        rayToTrans.setIdentity();
+        rayToTrans.setOrigin(rayToWorld);
+        LeafVisitor visitor([&] (void* data)
+        {
+            const Object& object = *static_cast<const Object*>(data);
+            if (!resultCallback.needsCollision(const_cast<btBroadphaseProxy*>(&object.mProxy)))
+                return;
+            btCollisionWorld::rayTestSingle(rayFromTrans, rayToTrans, static_cast<btCollisionObject*>(object.mProxy.m_clientObject),
+                object.mShape, object.mTransform, resultCallback);
+        });
+        btDbvt::rayTest(mTree.m_root, rayFromWorld, rayToWorld, visitor);
+    }
+
+    void CollisionSnapshot::aabbTest(const btVector3& aabbMin, const btVector3& aabbMax, btBroadphaseAabbCallback& callback) const
+    {
+        if (mTree.m_root == nullptr)
+            return;
+        LeafVisitor visitor([&] (void* data)
+        {
+            callback.process(&static_cast<const Object*>(data)->mProxy);
+        });
+        mTree.collideTV(mTree.m_root, btDbvtVolume::FromMM(aabbMin, aabbMax), visitor);
+    }
+
+    std::uint64_t CollisionSnapshotHolder::getGeneration() const
+    {
+        const std::shared_lock lock(mMutex);
+        return mGeneration;
+    }
+
+    void CollisionSnapshotHolder::invalidate()
+    {
+        const std::unique_lock lock(mMutex);
+        ++mGeneration;
+        mSnapshot.reset();
+    }
+
+    bool CollisionSnapshotHolder::publish(std::unique_ptr<const CollisionSnapshot>&& snapshot, std::uint64_t generation)
+    {
+        const std::unique_lock lock(mMutex);
+        if (generation != mGeneration)
+            return false;
+        mSnapshot = std::move(snapshot);
+        return true;
+    }
+}
@@ -0,0 +1,80 @@
+#ifndef OPENMW_MWPHYSICS_COLLISIONSNAPSHOT_H
+#define OPENMW_MWPHYSICS_COLLISIONSNAPSHOT_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+#include <BulletCollision/BroadphaseCollision/btBroadphaseProxy.h>
+#include <BulletCollision/BroadphaseCollision/btDbvt.h>
+#include <BulletCollision/CollisionDispatch/btCollisionWorld.h>
+
+class btBroadphaseAabbCallback;
+
+namespace MWPhysics
+{
+    /// @brief Read-only copy of the broadphase state of a collision world: object AABBs, filters, transforms and
+    /// shape pointers. Queries against it don't need a lock on the collision world.
+    /// @note Collision objects and shapes are referenced, not copied, so the snapshot must be dropped before any of
+    /// them is removed from the world.
+    class CollisionSnapshot
+    {
+        public:
+            explicit CollisionSnapshot(const btCollisionWorld& collisionWorld);
+
+            CollisionSnapshot(const CollisionSnapshot&) = delete;
+            CollisionSnapshot& operator=(const CollisionSnapshot&) = delete;
+
+            void rayTest(const btVector3& rayFromWorld, const btVector3& rayToWorld, btCollisionWorld::RayResultCallback& resultCallback) const;
+
+            void aabbTest(const btVector3& aabbMin, const btVector3& aabbMax, btBroadphaseAabbCallback& callback) const;
+
+            std::size_t size() const { return mObjects.size(); }
+
+        private:
+            struct Object
+            {
+                btBroadphaseProxy mProxy;
+                btTransform mTransform;
+                const btCollisionShape* mShape;
+            };
+
+            std::vector<Object> mObjects;
+            btDbvt mTree;
+    };
+
+    /// @brief Latest snapshot shared between threads. Each invalidation bumps the generation, so a snapshot built
+    /// before it can't be published afterwards.
+    class CollisionSnapshotHolder
+    {
+        public:
+            /// Should be read with the collision world locked, before building the snapshot.
+            std::uint64_t getGeneration() const;
+
+            /// Drops current snapshot and rejects ones built before. Call before collision objects are changed.
+            void invalidate();
+
+            /// Replaces current snapshot unless there was invalidation since the generation was read.
+            bool publish(std::unique_ptr<const CollisionSnapshot>&& snapshot, std::uint64_t generation);
+
+            /// Calls function with current snapshot while holding it. Returns false when there is none.
+            template <class Function>
+            bool query(Function&& function) const
+            {
+                const std::shared_lock lock(mMutex);
+                if (mSnapshot == nullptr)
+                    return false;
+                function(*mSnapshot);
+                return true;
+            }
+
+        private:
+            mutable std::shared_mutex mMutex;
+            std::uint64_t mGeneration = 0;
+            std::unique_ptr<const CollisionSnapshot> mSnapshot;
+    };
+}
+
+#endif
@@ -26,6 +26,7 @@
 #include "../mwbase/world.hpp"
 
 #include "actor.hpp"
+#include "collisionsnapshot.hpp"
 #include "contacttestwrapper.h"
 #include "movementsolver.hpp"
 #include "mtphysics.hpp"
@@ -317,11 +318,18 @@ namespace MWPhysics
           , mNumJobs(0)
           , mRemainingSteps(0)
           , mLOSCacheExpiry(Settings::Manager::getInt("lineofsight keep inactive cache", "Physics"))
+          , mLOSRefreshBudget(static_cast<std::size_t>(std::max(0, Settings::Manager::getInt("lineofsight refresh budget", "Physics"))))
+          , mLOSRefreshCursor(0)
+          , mLOSRefreshSize(0)
+          , mNumLOSRefresh(0)
+          , mLOSCacheHits(0)
+          , mLOSCacheMisses(0)
           , mFrameCounter(0)
           , mAdvanceSimulation(false)
           , mQuit(false)
           , mNextJob(0)
           , mNextLOS(0)
+          , mUseSnapshot(mNumThreads > 0 && Settings::Manager::getBool("async query snapshot", "Physics"))
           , mFrameNumber(0)
           , mTimer(osg::Timer::instance())
           , mPrevStepCount(1)
@@ -448,6 +456,9 @@ namespace MWPhysics
         mAdvanceSimulation = (mRemainingSteps != 0);
         ++mFrameCounter;
         mNumJobs = mSimulations.size();
+        // Requests are only appended until afterPostSim, so the indices of the refreshed window stay valid
+        mLOSRefreshSize = mLOSCache.size();
+        mNumLOSRefresh = static_cast<int>(mLOSRefreshBudget == 0 ? mLOSRefreshSize : std::min(mLOSRefreshBudget, mLOSRefreshSize));
         mNextLOS.store(0, std::memory_order_relaxed);
         mNextJob.store(0, std::memory_order_release);
 
@@ -488,6 +499,9 @@ namespace MWPhysics
 
     void PhysicsTaskScheduler::rayTest(const btVector3& rayFromWorld, const btVector3& rayToWorld, btCollisionWorld::RayResultCallback& resultCallback) const
     {
+        if (mUseSnapshot && mSnapshot.query([&] (const CollisionSnapshot& snapshot)
+                { snapshot.rayTest(rayFromWorld, rayToWorld, resultCallback); }))
+            return;
         MaybeLock lock(mCollisionWorldMutex, mNumThreads);
         mCollisionWorld->rayTest(rayFromWorld, rayToWorld, resultCallback);
     }
@@ -498,6 +512,50 @@ namespace MWPhysics
         mCollisionWorld->convexSweepTest(castShape, from, to, resultCallback);
     }
 
+    void PhysicsTaskScheduler::runQueryBatch(std::size_t count, const std::function<void(const btCollisionWorld&, std::size_t)>& query)
+    {
+        if (count == 0)
+            return;
+
+        MaybeLock lock(mCollisionWorldMutex, mNumThreads);
+
+        // Bullet is not guaranteed to support concurrent queries with a single worker thread
+        if (mNumThreads <= 1 || count == 1)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                query(*mCollisionWorld, i);
+            return;
+        }
+
+        std::lock_guard batchLock(mQueryBatchMutex);
+        QueryBatch batch {query, count};
+        mQueryBatch.store(&batch);
+        mHasJob.notify_all();
+
+        std::size_t i = 0;
+        while ((i = batch.mNext.fetch_add(1, std::memory_order_relaxed)) < count)
+            query(*mCollisionWorld, i);
+
+        // Helpers register themselves before looking at mQueryBatch, so once the batch is unpublished
+        // and no helper is registered nobody can access it anymore
+        mQueryBatch.store(nullptr);
+        while (mQueryBatchHelpers.load() != 0)
+            std::this_thread::yield();
+    }
+
+    void PhysicsTaskScheduler::helpWithQueryBatch()
+    {
+        // Runs without taking mCollisionWorldMutex: the thread which published the batch holds it until all helpers are done
+        ++mQueryBatchHelpers;
+        if (QueryBatch* batch = mQueryBatch.load())
+        {
+            std::size_t i = 0;
+            while ((i = batch->mNext.fetch_add(1, std::memory_order_relaxed)) < batch->mCount)
+                batch->mQuery(*mCollisionWorld, i);
+        }
+        --mQueryBatchHelpers;
+    }
+
     void PhysicsTaskScheduler::contactTest(btCollisionObject* colObj, btCollisionWorld::ContactResultCallback& resultCallback)
     {
         MaybeSharedLock lock(mCollisionWorldMutex, mNumThreads);
@@ -523,6 +581,9 @@ namespace MWPhysics
 
     void PhysicsTaskScheduler::aabbTest(const btVector3& aabbMin, const btVector3& aabbMax, btBroadphaseAabbCallback& callback)
     {
+        if (mUseSnapshot && mSnapshot.query([&] (const CollisionSnapshot& snapshot)
+                { snapshot.aabbTest(aabbMin, aabbMax, callback); }))
+            return;
         MaybeSharedLock lock(mCollisionWorldMutex, mNumThreads);
         mCollisionWorld->getBroadphase()->aabbTest(aabbMin, aabbMax, callback);
     }
@@ -536,6 +597,7 @@ namespace MWPhysics
     void PhysicsTaskScheduler::setCollisionFilterMask(btCollisionObject* collisionObject, int collisionFilterMask)
     {
         MaybeExclusiveLock lock(mCollisionWorldMutex, mNumThreads);
+        resetSnapshot();
         collisionObject->getBroadphaseHandle()->m_collisionFilterMask = collisionFilterMask;
     }
 
@@ -543,6 +605,7 @@ namespace MWPhysics
     {
         mCollisionObjects.insert(collisionObject);
         MaybeExclusiveLock lock(mCollisionWorldMutex, mNumThreads);
+        resetSnapshot();
         mCollisionWorld->addCollisionObject(collisionObject, collisionFilterGroup, collisionFilterMask);
     }
 
@@ -550,6 +613,7 @@ namespace MWPhysics
     {
         mCollisionObjects.erase(collisionObject);
         MaybeExclusiveLock lock(mCollisionWorldMutex, mNumThreads);
+        resetSnapshot();
         mCollisionWorld->removeCollisionObject(collisionObject);
     }
 
@@ -571,34 +635,60 @@ namespace MWPhysics
         MaybeExclusiveLock lock(mLOSCacheMutex, mNumThreads);
 
         auto req = LOSRequest(actor1, actor2);
-        auto result = std::find(mLOSCache.begin(), mLOSCache.end(), req);
-        if (result == mLOSCache.end())
+        const auto found = mLOSCacheIndex.find(req.mRawActors);
+        if (found == mLOSCacheIndex.end())
         {
+            ++mLOSCacheMisses;
             req.mResult = hasLineOfSight(actor1.get(), actor2.get());
+            mLOSCacheIndex.emplace(req.mRawActors, mLOSCache.size());
             mLOSCache.push_back(req);
             return req.mResult;
         }
-        result->mAge = 0;
-        return result->mResult;
+        ++mLOSCacheHits;
+        LOSRequest& result = mLOSCache[found->second];
+        result.mAge = 0;
+        return result.mResult;
     }
 
     void PhysicsTaskScheduler::refreshLOSCache()
     {
         MaybeSharedLock lock(mLOSCacheMutex, mNumThreads);
         int job = 0;
-        int numLOS = mLOSCache.size();
-        while ((job = mNextLOS.fetch_add(1, std::memory_order_relaxed)) < numLOS)
+        while ((job = mNextLOS.fetch_add(1, std::memory_order_relaxed)) < mNumLOSRefresh)
         {
-            auto& req = mLOSCache[job];
+            auto& req = mLOSCache[(mLOSRefreshCursor + job) % mLOSRefreshSize];
             auto actorPtr1 = req.mActors[0].lock();
             auto actorPtr2 = req.mActors[1].lock();
 
-            if (req.mAge++ > mLOSCacheExpiry || !actorPtr1 || !actorPtr2)
-                req.mStale = true;
-            else
+            if (actorPtr1 && actorPtr2)
                 req.mResult = hasLineOfSight(actorPtr1.get(), actorPtr2.get());
         }
+    }
 
+    void PhysicsTaskScheduler::expireLOSCache()
+    {
+        MaybeExclusiveLock lock(mLOSCacheMutex, mNumThreads);
+        if (mLOSRefreshSize != 0)
+            mLOSRefreshCursor = (mLOSRefreshCursor + mNumLOSRefresh) % mLOSRefreshSize;
+        std::size_t i = 0;
+        while (i < mLOSCache.size())
+        {
+            LOSRequest& req = mLOSCache[i];
+            if (req.mAge++ <= mLOSCacheExpiry && !req.mActors[0].expired() && !req.mActors[1].expired())
+            {
+                ++i;
+                continue;
+            }
+            mLOSCacheIndex.erase(req.mRawActors);
+            if (i != mLOSCache.size() - 1)
+            {
+                req = std::move(mLOSCache.back());
+                mLOSCacheIndex[req.mRawActors] = i;
+            }
+            mLOSCache.pop_back();
+        }
+        if (mLOSRefreshCursor >= mLOSCache.size())
+            mLOSRefreshCursor = 0;
     }
 
     void PhysicsTaskScheduler::updateAabbs()
@@ -642,7 +732,12 @@ namespace MWPhysics
         {
             if (lastFrame == mFrameCounter)
             {
-                mHasJob.wait(lock, [&] { return mQuit || lastFrame != mFrameCounter; });
+                mHasJob.wait(lock, [&] { return mQuit || lastFrame != mFrameCounter || mQueryBatch.load() != nullptr; });
+                if (!mQuit && lastFrame == mFrameCounter)
+                {
+                    helpWithQueryBatch();
+                    continue;
+                }
                 lastFrame = mFrameCounter;
             }
 
@@ -701,6 +796,14 @@ namespace MWPhysics
             stats.setAttribute(mFrameNumber, "physicsworker_time_taken", mTimer->delta_s(mTimeBegin, mTimeEnd));
             stats.setAttribute(mFrameNumber, "physicsworker_time_end", mTimer->delta_s(mFrameStart, mTimeEnd));
         }
+        {
+            MaybeExclusiveLock lock(mLOSCacheMutex, mNumThreads);
+            stats.setAttribute(frameNumber, "Physics LOSCacheSize", mLOSCache.size());
+            stats.setAttribute(frameNumber, "Physics LOSCacheHits", mLOSCacheHits);
+            stats.setAttribute(frameNumber, "Physics LOSCacheMisses", mLOSCacheMisses);
+            mLOSCacheHits = 0;
+            mLOSCacheMisses = 0;
+        }
         mFrameStart = frameStart;
         mTimeBegin = mTimer->tick();
         mFrameNumber = frameNumber;
@@ -751,13 +854,8 @@ namespace MWPhysics
 
     void PhysicsTaskScheduler::afterPostSim()
     {
-        {
-            MaybeExclusiveLock lock(mLOSCacheMutex, mNumThreads);
-            mLOSCache.erase(
-                    std::remove_if(mLOSCache.begin(), mLOSCache.end(),
-                        [](const LOSRequest& req) { return req.mStale; }),
-                    mLOSCache.end());
-        }
+        updateSnapshot();
+        expireLOSCache();
         mTimeEnd = mTimer->tick();
 
         std::unique_lock lock(mWorkersDoneMutex);
@@ -765,6 +863,28 @@ namespace MWPhysics
         mWorkersDone.notify_all();
     }
 
+    void PhysicsTaskScheduler::updateSnapshot()
+    {
+        if (!mUseSnapshot)
+            return;
+        std::uint64_t generation = 0;
+        std::unique_ptr<const CollisionSnapshot> snapshot;
+        {
+            MaybeSharedLock lock(mCollisionWorldMutex, mNumThreads);
+            generation = mSnapshot.getGeneration();
+            snapshot = std::make_unique<const CollisionSnapshot>(*mCollisionWorld);
+        }
+        // Objects might have been added or removed since the lock was released, then the snapshot is dropped
+        mSnapshot.publish(std::move(snapshot), generation);
+    }
+
+    void PhysicsTaskScheduler::resetSnapshot()
+    {
+        if (!mUseSnapshot)
+            return;
+        mSnapshot.invalidate();
+    }
+
     void PhysicsTaskScheduler::syncWithMainThread()
     {
         const Visitors::Sync vis{mAdvanceSimulation, mTimeAccum, mPhysicsDt, this};
@@ -1,11 +1,14 @@
 #ifndef OPENMW_MWPHYSICS_MTPHYSICS_H
 #define OPENMW_MWPHYSICS_MTPHYSICS_H
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <optional>
 #include <shared_mutex>
 #include <thread>
+#include <unordered_map>
 #include <unordered_set>
 #include <variant>
 
@@ -15,6 +18,7 @@
 
 #include "physicssystem.hpp"
 #include "ptrholder.hpp"
+#include "collisionsnapshot.hpp"
 #include "components/misc/budgetmeasurement.hpp"
 
 namespace Misc
@@ -29,6 +33,7 @@ namespace MWRender
 
 namespace MWPhysics
 {
+
     class PhysicsTaskScheduler
     {
         public:
@@ -47,6 +52,10 @@ namespace MWPhysics
             // Thread safe wrappers
             void rayTest(const btVector3& rayFromWorld, const btVector3& rayToWorld, btCollisionWorld::RayResultCallback& resultCallback) const;
             void convexSweepTest(const btConvexShape* castShape, const btTransform& from, const btTransform& to, btCollisionWorld::ConvexResultCallback& resultCallback) const;
+            /// @brief run query(collisionWorld, i) for each i in [0, count) under a single lock of the collision world
+            /// @note the queries are shared between the calling thread and idle physics worker threads, so query must be
+            /// thread safe and only perform read-only operations on the collision world
+            void runQueryBatch(std::size_t count, const std::function<void(const btCollisionWorld&, std::size_t)>& query);
             void contactTest(btCollisionObject* colObj, btCollisionWorld::ContactResultCallback& resultCallback);
             std::optional<btVector3> getHitPoint(const btTransform& from, btCollisionObject* target);
             void aabbTest(const btVector3& aabbMin, const btVector3& aabbMax, btBroadphaseAabbCallback& callback);
@@ -66,6 +75,7 @@ namespace MWPhysics
             void updateActorsPositions();
             bool hasLineOfSight(const Actor* actor1, const Actor* actor2);
             void refreshLOSCache();
+            void expireLOSCache();
             void updateAabbs();
             void updatePtrAabb(const std::shared_ptr<PtrHolder>& ptr);
             void updateStats(osg::Timer_t frameStart, unsigned int frameNumber, osg::Stats& stats);
@@ -75,6 +85,16 @@ namespace MWPhysics
             void afterPostSim();
             void syncWithMainThread();
             void waitForWorkers();
+            void helpWithQueryBatch();
+            void updateSnapshot();
+            void resetSnapshot();
+
+            struct QueryBatch
+            {
+                const std::function<void(const btCollisionWorld&, std::size_t)>& mQuery;
+                const std::size_t mCount;
+                std::atomic<std::size_t> mNext {0};
+            };
 
             std::unique_ptr<WorldFrameData> mWorldFrameData;
             std::vector<Simulation> mSimulations;
@@ -85,6 +105,7 @@ namespace MWPhysics
             btCollisionWorld* mCollisionWorld;
             MWRender::DebugDrawer* mDebugDrawer;
             std::vector<LOSRequest> mLOSCache;
+            std::unordered_map<std::array<const Actor*, 2>, std::size_t, LOSRequestHash> mLOSCacheIndex;
             std::set<std::weak_ptr<PtrHolder>, std::owner_less<std::weak_ptr<PtrHolder>>> mUpdateAabb;
 
             // TODO: use std::experimental::flex_barrier or std::barrier once it becomes a thing
@@ -96,6 +117,12 @@ namespace MWPhysics
             int mNumJobs;
             int mRemainingSteps;
             int mLOSCacheExpiry;
+            std::size_t mLOSRefreshBudget;
+            std::size_t mLOSRefreshCursor;
+            std::size_t mLOSRefreshSize;
+            int mNumLOSRefresh;
+            std::size_t mLOSCacheHits;
+            std::size_t mLOSCacheMisses;
             std::size_t mFrameCounter;
             bool mAdvanceSimulation;
             bool mQuit;
@@ -113,6 +140,15 @@ namespace MWPhysics
             mutable std::mutex mUpdateAabbMutex;
             std::condition_variable_any mHasJob;
 
+            std::mutex mQueryBatchMutex;
+            std::atomic<QueryBatch*> mQueryBatch {nullptr};
+            std::atomic<int> mQueryBatchHelpers {0};
+
+            // Queries hold the snapshot for as long as they use it, so it can be dropped safely before a collision
+            // object is added, removed or filtered differently
+            const bool mUseSnapshot;
+            CollisionSnapshotHolder mSnapshot;
+
             unsigned int mFrameNumber;
             const osg::Timer* mTimer;
 
@@ -26,6 +26,7 @@
 #include <components/esm3/loadgmst.hpp>
 #include <components/sceneutil/positionattitudetransform.hpp>
 #include <components/misc/convert.hpp>
+#include <components/misc/hash.hpp>
 #include <components/settings/settings.hpp>
 #include <components/nifosg/particle.hpp> // FindRecIndexVisitor
 
@@ -107,6 +108,8 @@ namespace MWPhysics
         , mActorCollisionShapeType(DetourNavigator::toCollisionShapeType(Settings::Manager::getInt("actor collision shape type", "Game")))
     {
         mResourceSystem->addResourceManager(mShapeManager.get());
+        if (!mResourceSystem->getShapeDiskCachePath().empty())
+            mShapeManager->setDiskCachePath(mResourceSystem->getShapeDiskCachePath());
 
         mCollisionConfiguration = std::make_unique<btDefaultCollisionConfiguration>();
         mDispatcher = std::make_unique<btCollisionDispatcher>(mCollisionConfiguration.get());
@@ -357,6 +360,72 @@ namespace MWPhysics
         return result;
     }
 
+    std::vector<RayCastingResult> PhysicsSystem::castRays(const std::vector<RayCastingRequest>& requests) const
+    {
+        struct Hit
+        {
+            const btCollisionObject* mObject = nullptr;
+            btVector3 mPosition;
+            btVector3 mNormal;
+        };
+
+        std::vector<const btCollisionObject*> ignored(requests.size(), nullptr);
+        for (std::size_t i = 0; i < requests.size(); ++i)
+        {
+            const MWWorld::ConstPtr& ignore = requests[i].mIgnore;
+            if (ignore.isEmpty())
+                continue;
+            if (const Actor* actor = getActor(ignore))
+                ignored[i] = actor->getCollisionObject();
+            else if (const Object* object = getObject(ignore))
+                ignored[i] = object->getCollisionObject();
+        }
+
+        std::vector<Hit> hits(requests.size());
+        mTaskScheduler->runQueryBatch(requests.size(), [&] (const btCollisionWorld& collisionWorld, std::size_t i)
+        {
+            const RayCastingRequest& request = requests[i];
+            if (request.mFrom == request.mTo)
+                return;
+            const btVector3 from = Misc::Convert::toBullet(request.mFrom);
+            const btVector3 to = Misc::Convert::toBullet(request.mTo);
+            if (request.mRadius > 0)
+            {
+                btCollisionWorld::ClosestConvexResultCallback callback(from, to);
+                callback.m_collisionFilterGroup = request.mGroup;
+                callback.m_collisionFilterMask = request.mMask;
+                const btSphereShape shape(request.mRadius);
+                const btQuaternion rotation = btQuaternion::getIdentity();
+                collisionWorld.convexSweepTest(&shape, btTransform(rotation, from), btTransform(rotation, to), callback);
+                if (callback.hasHit())
+                    hits[i] = Hit {callback.m_hitCollisionObject, callback.m_hitPointWorld, callback.m_hitNormalWorld};
+            }
+            else
+            {
+                ClosestNotMeRayResultCallback callback(ignored[i], {}, from, to);
+                callback.m_collisionFilterGroup = request.mGroup;
+                callback.m_collisionFilterMask = request.mMask;
+                collisionWorld.rayTest(from, to, callback);
+                if (callback.hasHit())
+                    hits[i] = Hit {callback.m_collisionObject, callback.m_hitPointWorld, callback.m_hitNormalWorld};
+            }
+        });
+
+        std::vector<RayCastingResult> results(requests.size());
+        for (std::size_t i = 0; i < requests.size(); ++i)
+        {
+            RayCastingResult& result = results[i];
+            result.mHit = hits[i].mObject != nullptr;
+            if (!result.mHit)
+                continue;
+            result.mHitPos = Misc::Convert::toOsg(hits[i].mPosition);
+            result.mHitNormal = Misc::Convert::toOsg(hits[i].mNormal);
+            if (auto* ptrHolder = static_cast<PtrHolder*>(hits[i].mObject->getUserPointer()))
+                result.mHitObject = ptrHolder->getPtr();
+        }
+        return results;
+    }
+
     bool PhysicsSystem::getLineOfSight(const MWWorld::ConstPtr &actor1, const MWWorld::ConstPtr &actor2) const
     {
         if (actor1 == actor2) return true;
@@ -991,7 +1060,7 @@ namespace MWPhysics
     {}
 
     LOSRequest::LOSRequest(const std::weak_ptr<Actor>& a1, const std::weak_ptr<Actor>& a2)
-        : mResult(false), mStale(false), mAge(0)
+        : mResult(false), mAge(0)
     {
         // we use raw actor pointer pair to uniquely identify request
         // sort the pointer value in ascending order to not duplicate equivalent requests, eg. getLOS(A, B) and getLOS(B, A)
@@ -1014,4 +1083,12 @@ namespace MWPhysics
     {
         return lhs.mRawActors == rhs.mRawActors;
     }
+
+    std::size_t LOSRequestHash::operator()(const std::array<const Actor*, 2>& actors) const noexcept
+    {
+        std::size_t seed = 0;
+        Misc::hashCombine(seed, actors[0]);
+        Misc::hashCombine(seed, actors[1]);
+        return seed;
+    }
 }
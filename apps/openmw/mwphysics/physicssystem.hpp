@@ -73,11 +73,15 @@ namespace MWPhysics
         std::array<std::weak_ptr<Actor>, 2> mActors;
         std::array<const Actor*, 2> mRawActors;
         bool mResult;
-        bool mStale;
         int mAge;
     };
     bool operator==(const LOSRequest& lhs, const LOSRequest& rhs) noexcept;
 
+    struct LOSRequestHash
+    {
+        std::size_t operator()(const std::array<const Actor*, 2>& actors) const noexcept;
+    };
+
     struct ActorFrameData
     {
         ActorFrameData(Actor& actor, bool inert, bool waterCollision, float slowFall, float waterlevel);
@@ -218,6 +222,8 @@ namespace MWPhysics
             RayCastingResult castSphere(const osg::Vec3f& from, const osg::Vec3f& to, float radius,
                     int mask = CollisionType_Default, int group=0xff) const override;
 
+            std::vector<RayCastingResult> castRays(const std::vector<RayCastingRequest>& requests) const override;
+
             /// Return true if actor1 can see actor2.
             bool getLineOfSight(const MWWorld::ConstPtr& actor1, const MWWorld::ConstPtr& actor2) const override;
 
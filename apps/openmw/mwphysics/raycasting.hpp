@@ -1,6 +1,8 @@
 #ifndef OPENMW_MWPHYSICS_RAYCASTING_H
 #define OPENMW_MWPHYSICS_RAYCASTING_H
 
+#include <vector>
+
 #include <osg/Vec3f>
 
 #include "../mwworld/ptr.hpp"
@@ -18,6 +20,18 @@ namespace MWPhysics
             MWWorld::Ptr mHitObject;
     };
 
+    struct RayCastingRequest
+    {
+        osg::Vec3f mFrom;
+        osg::Vec3f mTo;
+        /// If greater than zero, a sphere of this radius is swept instead of casting a ray.
+        float mRadius = 0;
+        /// Optional, a Ptr to ignore in the list of results. Not supported for sphere casts.
+        MWWorld::ConstPtr mIgnore;
+        int mMask = CollisionType_Default;
+        int mGroup = 0xff;
+    };
+
     class RayCastingInterface
     {
         public:
@@ -35,6 +49,10 @@ namespace MWPhysics
             virtual RayCastingResult castSphere(const osg::Vec3f& from, const osg::Vec3f& to, float radius,
                     int mask = CollisionType_Default, int group=0xff) const = 0;
 
+            /// Cast all rays and spheres of the batch at once, which is cheaper than separate castRay and castSphere calls.
+            /// @return a result for each request, in the same order
+            virtual std::vector<RayCastingResult> castRays(const std::vector<RayCastingRequest>& requests) const = 0;
+
             /// Return true if actor1 can see actor2.
             virtual bool getLineOfSight(const MWWorld::ConstPtr& actor1, const MWWorld::ConstPtr& actor2) const = 0;
     };
@@ -411,6 +411,110 @@ namespace MWRender
         mMinSizeCostMultiplier = Settings::Manager::getFloat("object paging min size cost multiplier", "Terrain");
     }
 
+    std::shared_ptr<const ObjectPaging::CellRefIndex> ObjectPaging::getCellRefIndex(const ESM::Cell& cell, const MWWorld::ESMStore& store, ESM::ReadersCache& readers)
+    {
+        const std::pair<int, int> key(cell.getGridX(), cell.getGridY());
+        {
+            std::lock_guard<std::mutex> lock(mCellRefIndicesMutex);
+            const auto found = mCellRefIndices.find(key);
+            if (found != mCellRefIndices.end())
+                return found->second;
+        }
+
+        struct IndexedRef
+        {
+            int mType;
+            std::string mRefId;
+            ESM::Position mPos;
+            float mScale;
+        };
+        std::map<ESM::RefNum, IndexedRef> refs;
+        std::map<ESM::RefNum, int> deletedRefs;
+
+        const auto addRef = [&] (ESM::CellRef& ref, bool deleted)
+        {
+            Misc::StringUtils::lowerCaseInPlace(ref.mRefID);
+            const int type = store.findStatic(ref.mRefID);
+            if (!typeFilter(type, false))
+                return;
+            if (deleted)
+            {
+                refs.erase(ref.mRefNum);
+                deletedRefs[ref.mRefNum] = type;
+                return;
+            }
+            deletedRefs.erase(ref.mRefNum);
+            refs[ref.mRefNum] = IndexedRef {type, std::move(ref.mRefID), ref.mPos, ref.mScale};
+        };
+
+        for (size_t i=0; i<cell.mContextList.size(); ++i)
+        {
+            try
+            {
+                const std::size_t index = static_cast<std::size_t>(cell.mContextList[i].index);
+                const ESM::ReadersCache::BusyItem reader = readers.get(index);
+                cell.restore(*reader, i);
+                ESM::CellRef ref;
+                ref.mRefNum.unset();
+                ESM::MovedCellRef cMRef;
+                cMRef.mRefNum.mIndex = 0;
+                bool deleted = false;
+                bool moved = false;
+                while (ESM::Cell::getNextRef(*reader, ref, deleted, cMRef, moved, ESM::Cell::GetNextRefMode::LoadOnlyNotMoved))
+                {
+                    if (moved)
+                        continue;
+
+                    if (std::find(cell.mMovedRefs.begin(), cell.mMovedRefs.end(), ref.mRefNum) != cell.mMovedRefs.end())
+                        continue;
+
+                    addRef(ref, deleted);
+                }
+            }
+            catch (std::exception&)
+            {
+                continue;
+            }
+        }
+        for (auto [ref, deleted] : cell.mLeasedRefs)
+            addRef(ref, deleted);
+
+        auto result = std::make_shared<CellRefIndex>();
+        result->mRefNums.reserve(refs.size());
+        result->mTypes.reserve(refs.size());
+        result->mModels.reserve(refs.size());
+        result->mPositions.reserve(refs.size());
+        result->mScales.reserve(refs.size());
+        std::unordered_map<std::string, std::uint32_t> modelIndices;
+        for (const auto& [refNum, ref] : refs)
+        {
+            std::string model;
+            if (!Misc::ResourceHelpers::isHiddenMarker(ref.mRefId))
+                model = getModel(ref.mType, ref.mRefId, store);
+            if (!model.empty())
+                model = Misc::ResourceHelpers::correctMeshPath(model, mSceneManager->getVFS());
+            const auto emplaced = modelIndices.emplace(model, static_cast<std::uint32_t>(result->mModelNames.size()));
+            if (emplaced.second)
+                result->mModelNames.push_back(std::move(model));
+
+            result->mRefNums.push_back(refNum);
+            result->mTypes.push_back(ref.mType);
+            result->mModels.push_back(emplaced.first->second);
+            result->mPositions.push_back(ref.mPos);
+            result->mScales.push_back(ref.mScale);
+        }
+        result->mDeletedRefNums.reserve(deletedRefs.size());
+        result->mDeletedTypes.reserve(deletedRefs.size());
+        for (const auto& [refNum, type] : deletedRefs)
+        {
+            result->mDeletedRefNums.push_back(refNum);
+            result->mDeletedTypes.push_back(type);
+        }
+
+        std::lock_guard<std::mutex> lock(mCellRefIndicesMutex);
+        return mCellRefIndices.emplace(key, std::move(result)).first->second;
+    }
+
     osg::ref_ptr<osg::Node> ObjectPaging::createChunk(float size, const osg::Vec2f& center, bool activeGrid, const osg::Vec3f& viewPoint, bool compile)
     {
         osg::Vec2i startCell = osg::Vec2i(std::floor(center.x() - size/2.f), std::floor(center.y() - size/2.f));
@@ -418,7 +522,17 @@ namespace MWRender
         osg::Vec3f worldCenter = osg::Vec3f(center.x(), center.y(), 0)*ESM::Land::REAL_SIZE;
         osg::Vec3f relativeViewPoint = viewPoint - worldCenter;
 
-        std::map<ESM::RefNum, ESM::CellRef> refs;
+        struct ChunkRef
+        {
+            int mType;
+            const std::string* mModel;
+            ESM::Position mPos;
+            float mScale;
+            ESM::RefNum mRefNum;
+        };
+
+        std::map<ESM::RefNum, ChunkRef> refs;
+        std::vector<std::shared_ptr<const CellRefIndex>> cellRefIndices;
         ESM::ReadersCache readers;
         const MWWorld::ESMStore& store = MWBase::Environment::get().getWorld()->getStore();
 
@@ -428,50 +542,17 @@ namespace MWRender
             {
                 const ESM::Cell* cell = store.get<ESM::Cell>().searchStatic(cellX, cellY);
                 if (!cell) continue;
-                for (size_t i=0; i<cell->mContextList.size(); ++i)
+                const CellRefIndex& index = *cellRefIndices.emplace_back(getCellRefIndex(*cell, store, readers));
+                for (std::size_t i = 0; i < index.mDeletedRefNums.size(); ++i)
                 {
-                    try
-                    {
-                        const std::size_t index = static_cast<std::size_t>(cell->mContextList[i].index);
-                        const ESM::ReadersCache::BusyItem reader = readers.get(index);
-                        cell->restore(*reader, i);
-                        ESM::CellRef ref;
-                        ref.mRefNum.unset();
-                        ESM::MovedCellRef cMRef;
-                        cMRef.mRefNum.mIndex = 0;
-                        bool deleted = false;
-                        bool moved = false;
-                        while (ESM::Cell::getNextRef(*reader, ref, deleted, cMRef, moved, ESM::Cell::GetNextRefMode::LoadOnlyNotMoved))
-                        {
-                            if (moved)
-                                continue;
-
-                            if (std::find(cell->mMovedRefs.begin(), cell->mMovedRefs.end(), ref.mRefNum) != cell->mMovedRefs.end())
-                                continue;
-
-                            Misc::StringUtils::lowerCaseInPlace(ref.mRefID);
-                            int type = store.findStatic(ref.mRefID);
-                            if (!typeFilter(type,size>=2)) continue;
-                            if (deleted) { refs.erase(ref.mRefNum); continue; }
-                            refs[ref.mRefNum] = std::move(ref);
-                        }
-                    }
-                    catch (std::exception&)
-                    {
-                        continue;
-                    }
+                    if (typeFilter(index.mDeletedTypes[i], size>=2))
+                        refs.erase(index.mDeletedRefNums[i]);
                 }
-                for (auto [ref, deleted] : cell->mLeasedRefs)
+                for (std::size_t i = 0; i < index.mRefNums.size(); ++i)
                 {
-                    if (deleted)
-                    {
-                        refs.erase(ref.mRefNum);
-                        continue;
-                    }
-                    Misc::StringUtils::lowerCaseInPlace(ref.mRefID);
-                    int type = store.findStatic(ref.mRefID);
-                    if (!typeFilter(type,size>=2)) continue;
-                    refs[ref.mRefNum] = std::move(ref);
+                    if (!typeFilter(index.mTypes[i], size>=2)) continue;
+                    refs[index.mRefNums[i]] = ChunkRef {index.mTypes[i], &index.mModelNames[index.mModels[i]],
+                        index.mPositions[i], index.mScales[i], index.mRefNums[i]};
                 }
             }
         }
@@ -487,7 +568,7 @@ namespace MWRender
         osg::Vec2f maxBound = (center + osg::Vec2f(size/2.f, size/2.f));
         struct InstanceList
         {
-            std::vector<const ESM::CellRef*> mInstances;
+            std::vector<const ChunkRef*> mInstances;
             AnalyzeVisitor::Result mAnalyzeResult;
             bool mNeedCompile = false;
         };
@@ -508,7 +589,7 @@ namespace MWRender
             minSize *= mMinSizeMergeFactor;
         for (const auto& pair : refs)
         {
-            const ESM::CellRef& ref = pair.second;
+            const ChunkRef& ref = pair.second;
 
             osg::Vec3f pos = ref.mPos.asVec3();
             if (size < 1.f)
@@ -528,15 +609,12 @@ namespace MWRender
                     continue;
             }
 
-            if (Misc::ResourceHelpers::isHiddenMarker(ref.mRefID))
+            if (ref.mModel->empty())
                 continue;
 
-            int type = store.findStatic(ref.mRefID);
-            std::string model = getModel(type, ref.mRefID, store);
-            if (model.empty()) continue;
-            model = Misc::ResourceHelpers::correctMeshPath(model, mSceneManager->getVFS());
+            std::string model = *ref.mModel;
 
-            if (activeGrid && type != ESM::REC_STAT)
+            if (activeGrid && ref.mType != ESM::REC_STAT)
             {
                 model = Misc::ResourceHelpers::correctActorModelPath(model, mSceneManager->getVFS());
                 std::string kfname = Misc::StringUtils::lowerCase(model);
@@ -609,7 +687,7 @@ namespace MWRender
             unsigned int numinstances = 0;
             for (auto cref : pair.second.mInstances)
             {
-                const ESM::CellRef& ref = *cref;
+                const ChunkRef& ref = *cref;
                 osg::Vec3f pos = ref.mPos.asVec3();
 
                 if (!activeGrid && minSizeMerged != minSize && cnode->getBound().radius2() * cref->mScale*cref->mScale < (viewPoint-pos).length2()*minSizeMerged*minSizeMerged)
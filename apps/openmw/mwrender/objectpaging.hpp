@@ -5,6 +5,8 @@
 #include <components/resource/resourcemanager.hpp>
 #include <components/esm3/loadcell.hpp>
 
+#include <cstdint>
+#include <memory>
 #include <mutex>
 
 namespace Resource
@@ -15,6 +17,10 @@ namespace MWWorld
 {
     class ESMStore;
 }
+namespace ESM
+{
+    class ReadersCache;
+}
 
 namespace MWRender
 {
@@ -75,6 +81,30 @@ namespace MWRender
         std::mutex mSizeCacheMutex;
         typedef std::map<ESM::RefNum, float> SizeCache;
         SizeCache mSizeCache;
+
+        /// References of an exterior cell that can be paged, collected once from the content files and the
+        /// leased refs of the cell so that building a chunk does not need to read the content files again.
+        struct CellRefIndex
+        {
+            // Refs present in the cell, after the refs of all content files and moved refs are applied.
+            std::vector<ESM::RefNum> mRefNums;
+            std::vector<int> mTypes;
+            std::vector<std::uint32_t> mModels; // Index in mModelNames
+            std::vector<ESM::Position> mPositions;
+            std::vector<float> mScales;
+
+            // Refs deleted by the cell. These remove refs of the same RefNum collected from previous cells.
+            std::vector<ESM::RefNum> mDeletedRefNums;
+            std::vector<int> mDeletedTypes;
+
+            // Corrected mesh paths, empty for refs that are never rendered.
+            std::vector<std::string> mModelNames;
+        };
+
+        std::shared_ptr<const CellRefIndex> getCellRefIndex(const ESM::Cell& cell, const MWWorld::ESMStore& store, ESM::ReadersCache& readers);
+
+        std::mutex mCellRefIndicesMutex;
+        std::map<std::pair<int, int>, std::shared_ptr<const CellRefIndex>> mCellRefIndices;
     };
 
     class RefnumMarker : public osg::Object
@@ -87,10 +87,10 @@ namespace MWScript
 
     MissingImplicitRefError::MissingImplicitRefError() : std::runtime_error("no implicit reference") {}
 
-    int InterpreterContext::findLocalVariableIndex(std::string_view scriptId, std::string_view name, char type) const
+    int InterpreterContext::findLocalVariableIndex(std::string_view scriptId, std::string_view name, char type,
+        Interpreter::MemberSlot* slot) const
     {
-        int index = MWBase::Environment::get().getScriptManager()->getLocals (scriptId).
-            searchIndex (type, name);
+        int index = MWBase::Environment::get().getScriptManager()->getLocalIndex(scriptId, name, type, slot);
 
         if (index!=-1)
             return index;
@@ -425,49 +425,51 @@ namespace MWScript
     }
 
     int InterpreterContext::getMemberShort(std::string_view id, std::string_view name,
-        bool global) const
+        bool global, Interpreter::MemberSlot* slot) const
     {
         const Locals& locals = getMemberLocals(id, global);
 
-        return locals.mShorts[findLocalVariableIndex(id, name, 's')];
+        return locals.mShorts[findLocalVariableIndex(id, name, 's', slot)];
     }
 
     int InterpreterContext::getMemberLong(std::string_view id, std::string_view name,
-        bool global) const
+        bool global, Interpreter::MemberSlot* slot) const
     {
         const Locals& locals = getMemberLocals(id, global);
 
-        return locals.mLongs[findLocalVariableIndex(id, name, 'l')];
+        return locals.mLongs[findLocalVariableIndex(id, name, 'l', slot)];
     }
 
     float InterpreterContext::getMemberFloat(std::string_view id, std::string_view name,
-        bool global) const
+        bool global, Interpreter::MemberSlot* slot) const
     {
         const Locals& locals = getMemberLocals(id, global);
 
-        return locals.mFloats[findLocalVariableIndex(id, name, 'f')];
+        return locals.mFloats[findLocalVariableIndex(id, name, 'f', slot)];
     }
 
     void InterpreterContext::setMemberShort(std::string_view id, std::string_view name,
-        int value, bool global)
+        int value, bool global, Interpreter::MemberSlot* slot)
     {
         Locals& locals = getMemberLocals(id, global);
 
-        locals.mShorts[findLocalVariableIndex(id, name, 's')] = value;
+        locals.mShorts[findLocalVariableIndex(id, name, 's', slot)] = value;
     }
 
-    void InterpreterContext::setMemberLong(std::string_view id, std::string_view name, int value, bool global)
+    void InterpreterContext::setMemberLong(std::string_view id, std::string_view name, int value, bool global,
+        Interpreter::MemberSlot* slot)
     {
         Locals& locals = getMemberLocals(id, global);
 
-        locals.mLongs[findLocalVariableIndex(id, name, 'l')] = value;
+        locals.mLongs[findLocalVariableIndex(id, name, 'l', slot)] = value;
     }
 
-    void InterpreterContext::setMemberFloat(std::string_view id, std::string_view name, float value, bool global)
+    void InterpreterContext::setMemberFloat(std::string_view id, std::string_view name, float value, bool global,
+        Interpreter::MemberSlot* slot)
     {
         Locals& locals = getMemberLocals(id, global);
 
-        locals.mFloats[findLocalVariableIndex(id, name, 'f')] = value;
+        locals.mFloats[findLocalVariableIndex(id, name, 'f', slot)] = value;
     }
 
     MWWorld::Ptr InterpreterContext::getReference(bool required) const
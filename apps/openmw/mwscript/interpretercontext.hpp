@@ -37,7 +37,8 @@ namespace MWScript
             ///< \a id is changed to the respective script ID, if \a id wasn't a script ID before
 
             /// Throws an exception if local variable can't be found.
-            int findLocalVariableIndex(std::string_view scriptId, std::string_view name, char type) const;
+            int findLocalVariableIndex(std::string_view scriptId, std::string_view name, char type,
+                Interpreter::MemberSlot* slot) const;
 
         public:
             InterpreterContext (std::shared_ptr<GlobalScriptDesc> globalScriptDesc);
@@ -112,17 +113,23 @@ namespace MWScript
             void executeActivation(const MWWorld::Ptr& ptr, const MWWorld::Ptr& actor);
             ///< Execute the activation action for this ptr. If ptr is mActivated, mark activation as handled.
 
-            int getMemberShort(std::string_view id, std::string_view name, bool global) const override;
+            int getMemberShort(std::string_view id, std::string_view name, bool global,
+                Interpreter::MemberSlot* slot) const override;
 
-            int getMemberLong(std::string_view id, std::string_view name, bool global) const override;
+            int getMemberLong(std::string_view id, std::string_view name, bool global,
+                Interpreter::MemberSlot* slot) const override;
 
-            float getMemberFloat(std::string_view id, std::string_view name, bool global) const override;
+            float getMemberFloat(std::string_view id, std::string_view name, bool global,
+                Interpreter::MemberSlot* slot) const override;
 
-            void setMemberShort(std::string_view id, std::string_view name, int value, bool global) override;
+            void setMemberShort(std::string_view id, std::string_view name, int value, bool global,
+                Interpreter::MemberSlot* slot) override;
 
-            void setMemberLong(std::string_view id, std::string_view name, int value, bool global) override;
+            void setMemberLong(std::string_view id, std::string_view name, int value, bool global,
+                Interpreter::MemberSlot* slot) override;
 
-            void setMemberFloat(std::string_view id, std::string_view name, float value, bool global) override;
+            void setMemberFloat(std::string_view id, std::string_view name, float value, bool global,
+                Interpreter::MemberSlot* slot) override;
 
             MWWorld::Ptr getReference(bool required=true) const;
             ///< Reference, that the script is running from (can be empty)
@@ -0,0 +1,27 @@
+#include "localindexcache.hpp"
+
+#include <components/compiler/locals.hpp>
+#include <components/misc/strings/lower.hpp>
+
+namespace MWScript
+{
+    int LocalIndexCache::resolve(std::string_view scriptId, const Compiler::Locals& locals, std::string_view name,
+        char type, Interpreter::MemberSlot* slot) const
+    {
+        const int index = locals.searchIndex(type, Misc::StringUtils::lowerCase(name));
+
+        if (slot != nullptr)
+        {
+            slot->mScriptId = scriptId;
+            slot->mRevision = mRevision;
+            slot->mIndex = index;
+        }
+
+        return index;
+    }
+
+    void LocalIndexCache::invalidate()
+    {
+        ++mRevision;
+    }
+}
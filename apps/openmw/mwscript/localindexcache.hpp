@@ -0,0 +1,44 @@
+#ifndef GAME_SCRIPT_LOCALINDEXCACHE_H
+#define GAME_SCRIPT_LOCALINDEXCACHE_H
+
+#include <components/interpreter/types.hpp>
+
+#include <cstdint>
+#include <string_view>
+
+namespace Compiler
+{
+    class Locals;
+}
+
+namespace MWScript
+{
+    /// \brief Indices of member variables resolved for call sites of prepared scripts
+    ///
+    /// Indices are stored in the call site's Interpreter::MemberSlot and resolved again after invalidate.
+    class LocalIndexCache
+    {
+            std::uint64_t mRevision = 1;
+
+            int resolve(std::string_view scriptId, const Compiler::Locals& locals, std::string_view name, char type,
+                Interpreter::MemberSlot* slot) const;
+
+        public:
+
+            template <class GetLocals>
+            int get(std::string_view scriptId, std::string_view name, char type, Interpreter::MemberSlot* slot,
+                GetLocals&& getLocals) const
+            {
+                if (slot != nullptr && slot->mRevision == mRevision && slot->mScriptId == scriptId)
+                    return slot->mIndex;
+                return resolve(scriptId, getLocals(), name, type, slot);
+            }
+            ///< Return index of local variable \a name of type \a type in script \a scriptId
+            /// (-1: does not exist). \a getLocals is called only when \a slot has no valid index.
+
+            void invalidate();
+            ///< Resolve all indices again, must be called when locals of any script change.
+    };
+}
+
+#endif
@@ -4,6 +4,7 @@
 #include <sstream>
 #include <exception>
 #include <algorithm>
+#include <stdexcept>
 
 #include <components/debug/debuglog.hpp>
 
@@ -80,7 +81,12 @@ namespace MWScript
             {
                 std::vector<Interpreter::Type_Code> code;
                 mParser.getCode(code);
-                mScripts.emplace(name, CompiledScript(code, mParser.getLocals()));
+                // Decode the script once instead of on every run
+                ensureOpcodesInstalled();
+                Interpreter::Program program = mInterpreter.prepare(code.data(), static_cast<int>(code.size()));
+                mScripts.emplace(name, CompiledScript(code, std::move(program), mParser.getLocals()));
+                // Indices resolved from the previous locals may be stale now
+                mLocalIndices.invalidate();
 
                 return true;
             }
@@ -100,7 +106,8 @@ namespace MWScript
             {
                 // failed -> ignore script from now on.
                 std::vector<Interpreter::Type_Code> empty;
-                mScripts.emplace(name, CompiledScript(empty, Compiler::Locals()));
+                mScripts.emplace(name, CompiledScript(empty, Interpreter::Program(), Compiler::Locals()));
+                mLocalIndices.invalidate();
                 return false;
             }
 
@@ -113,13 +120,9 @@ namespace MWScript
         if (!iter->second.mByteCode.empty() && iter->second.mInactive.find(target) == iter->second.mInactive.end())
             try
             {
-                if (!mOpcodesInstalled)
-                {
-                    installOpcodes (mInterpreter);
-                    mOpcodesInstalled = true;
-                }
-
-                mInterpreter.run (&iter->second.mByteCode[0], iter->second.mByteCode.size(), interpreterContext);
+                const CompiledScript& script = iter->second;
+                mInterpreter.run (script.mByteCode.data(), static_cast<int>(script.mByteCode.size()), script.mProgram,
+                    interpreterContext);
                 return true;
             }
             catch (const MissingImplicitRefError& e)
@@ -135,6 +138,14 @@ namespace MWScript
         return false;
     }
 
+    void ScriptManager::ensureOpcodesInstalled()
+    {
+        if (mOpcodesInstalled)
+            return;
+        installOpcodes (mInterpreter);
+        mOpcodesInstalled = true;
+    }
+
     void ScriptManager::clear()
     {
         for (auto& script : mScripts)
@@ -206,6 +217,7 @@ namespace MWScript
             }
 
             auto iter = mOtherLocals.emplace(name, locals).first;
+            mLocalIndices.invalidate();
 
             return iter->second;
         }
@@ -213,6 +225,13 @@ namespace MWScript
         throw std::logic_error("script " + std::string{name} + " does not exist");
     }
 
+    int ScriptManager::getLocalIndex(std::string_view scriptId, std::string_view name, char type,
+        Interpreter::MemberSlot* slot)
+    {
+        return mLocalIndices.get(scriptId, name, type, slot,
+            [&] () -> const Compiler::Locals& { return getLocals(scriptId); });
+    }
+
     GlobalScripts& ScriptManager::getGlobalScripts()
     {
         return mGlobalScripts;
@@ -4,6 +4,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 
 #include <components/compiler/streamerrorhandler.hpp>
 #include <components/compiler/fileparser.hpp>
@@ -14,6 +15,7 @@
 #include "../mwbase/scriptmanager.hpp"
 
 #include "globalscripts.hpp"
+#include "localindexcache.hpp"
 
 namespace MWWorld
 {
@@ -45,11 +47,13 @@ namespace MWScript
             struct CompiledScript
             {
                 std::vector<Interpreter::Type_Code> mByteCode;
+                Interpreter::Program mProgram;
                 Compiler::Locals mLocals;
                 std::set<std::string> mInactive;
 
-                CompiledScript(const std::vector<Interpreter::Type_Code>& code, const Compiler::Locals& locals):
-                    mByteCode(code), mLocals(locals)
+                CompiledScript(const std::vector<Interpreter::Type_Code>& code, Interpreter::Program&& program,
+                    const Compiler::Locals& locals):
+                    mByteCode(code), mProgram(std::move(program)), mLocals(locals)
                 {}
             };
 
@@ -58,6 +62,10 @@ namespace MWScript
             std::unordered_map<std::string, Compiler::Locals, ::Misc::StringUtils::CiHash, ::Misc::StringUtils::CiEqual> mOtherLocals;
             std::vector<std::string> mScriptBlacklist;
 
+            LocalIndexCache mLocalIndices;
+
+            void ensureOpcodesInstalled();
+
         public:
 
             ScriptManager (const MWWorld::ESMStore& store,
@@ -80,6 +88,11 @@ namespace MWScript
             const Compiler::Locals& getLocals(std::string_view name) override;
             ///< Return locals for script \a name.
 
+            int getLocalIndex(std::string_view scriptId, std::string_view name, char type,
+                Interpreter::MemberSlot* slot) override;
+            ///< Return index of local variable \a name of type \a type in script \a scriptId
+            /// (-1: does not exist). The index is kept in \a slot until locals of any script change.
+
             GlobalScripts& getGlobalScripts() override;
 
             const Compiler::Extensions& getExtensions() const override;
@@ -375,6 +375,21 @@ namespace MWWorld
         MergeVisitor visitor(mMergedRefs, mMovedHere, mMovedToAnotherCell);
         forEachInternal(visitor);
         visitor.merge();
+
+        mMergedRefsById.clear();
+        for (LiveCellRefBase* ref : mMergedRefs)
+            mMergedRefsById[ref->mRef.getRefId()].push_back(ref);
+    }
+
+    LiveCellRefBase* CellStore::searchMergedRefs(std::string_view id) const
+    {
+        const auto it = mMergedRefsById.find(id);
+        if (it == mMergedRefsById.end())
+            return nullptr;
+        for (LiveCellRefBase* ref : it->second)
+            if (isAccessible(ref->mData, ref->mRef))
+                return ref;
+        return nullptr;
     }
 
     bool CellStore::movedHere(const MWWorld::Ptr& ptr) const
@@ -431,36 +446,27 @@ namespace MWWorld
         return searchConst (id).isEmpty();
     }
 
-    template <typename PtrType>
-    struct SearchVisitor
-    {
-        PtrType mFound;
-        const std::string *mIdToFind;
-        bool operator()(const PtrType& ptr)
-        {
-            if (ptr.getCellRef().getRefId() == *mIdToFind)
-            {
-                mFound = ptr;
-                return false;
-            }
-            return true;
-        }
-    };
-
     Ptr CellStore::search (const std::string& id)
     {
-        SearchVisitor<MWWorld::Ptr> searchVisitor;
-        searchVisitor.mIdToFind = &id;
-        forEach(searchVisitor);
-        return searchVisitor.mFound;
+        if (mState != State_Loaded || mMergedRefs.empty())
+            return Ptr();
+
+        // Same as forEach, the found object may be changed by the caller
+        mHasState = true;
+
+        if (LiveCellRefBase* ref = searchMergedRefs(id))
+            return Ptr(ref, this);
+        return Ptr();
     }
 
     ConstPtr CellStore::searchConst (const std::string& id) const
     {
-        SearchVisitor<MWWorld::ConstPtr> searchVisitor;
-        searchVisitor.mIdToFind = &id;
-        forEachConst(searchVisitor);
-        return searchVisitor.mFound;
+        if (mState != State_Loaded)
+            return ConstPtr();
+
+        if (const LiveCellRefBase* ref = searchMergedRefs(id))
+            return ConstPtr(ref, this);
+        return ConstPtr();
     }
 
     Ptr CellStore::searchViaActorId (int id)
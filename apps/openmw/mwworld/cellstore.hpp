@@ -7,6 +7,7 @@
 #include <typeinfo>
 #include <map>
 #include <memory>
+#include <unordered_map>
 
 #include "livecellref.hpp"
 #include "cellreflist.hpp"
@@ -32,6 +33,7 @@
 #include <components/esm3/loadmisc.hpp>
 #include <components/esm3/loadbody.hpp>
 #include <components/esm3/fogstate.hpp>
+#include <components/misc/strings/algorithm.hpp>
 
 #include "timestamp.hpp"
 #include "ptr.hpp"
@@ -111,15 +113,21 @@ namespace MWWorld
             // Merged list of ref's currently in this cell - i.e. with added refs from mMovedHere, removed refs from mMovedToAnotherCell
             std::vector<LiveCellRefBase*> mMergedRefs;
 
+            // mMergedRefs grouped by RefId preserving the order, used for lookups by id without visiting every ref
+            std::unordered_map<std::string, std::vector<LiveCellRefBase*>, Misc::StringUtils::CiHash,
+                Misc::StringUtils::CiEqual> mMergedRefsById;
+
             // Get the Ptr for the given ref which originated from this cell (possibly moved to another cell at this point).
             Ptr getCurrentPtr(MWWorld::LiveCellRefBase* ref);
 
             /// Moves object from the given cell to this cell.
             void moveFrom(const MWWorld::Ptr& object, MWWorld::CellStore* from);
 
-            /// Repopulate mMergedRefs.
+            /// Repopulate mMergedRefs and mMergedRefsById.
             void updateMergedRefs();
 
+            LiveCellRefBase* searchMergedRefs(std::string_view id) const;
+
             // (item, max charge)
             typedef std::vector<std::pair<LiveCellRefBase*, float> > TRechargingItems;
             TRechargingItems mRechargingItems;
@@ -3,6 +3,8 @@
 
 #include <components/esm3/esmreader.hpp>
 #include <components/esm3/readerscache.hpp>
+#include <components/misc/parallelfor.hpp>
+#include <components/to_utf8/to_utf8.hpp>
 
 namespace MWWorld
 {
@@ -15,28 +17,70 @@ EsmLoader::EsmLoader(MWWorld::ESMStore& store, ESM::ReadersCache& readers, ToUTF
 {
 }
 
+void EsmLoader::stage(const std::vector<std::pair<int, boost::filesystem::path>>& files, std::size_t threadsCount)
+{
+    // Parent file indices are resolved using readers of the previous files so opening has to be done in order
+    std::vector<ESM::ESM_Context> contexts;
+    contexts.reserve(files.size());
+    for (const auto& [index, filepath] : files)
+    {
+        const ESM::ReadersCache::BusyItem reader = mReaders.get(static_cast<std::size_t>(index));
+        open(*reader, filepath, index);
+        contexts.push_back(reader->getContext());
+    }
+
+    std::vector<ESMStore::StagedRecords> staged(files.size());
+    Misc::parallelFor(files.size(), threadsCount, [&] (std::size_t i)
+    {
+        // Utf8Encoder is not thread safe, each thread needs an own copy
+        std::optional<ToUTF8::Utf8Encoder> encoder;
+        if (mEncoder != nullptr)
+            encoder.emplace(*mEncoder);
+        ESM::ESMReader reader;
+        reader.setEncoder(encoder.has_value() ? &*encoder : nullptr);
+        reader.open(files[i].second.string());
+        reader.restoreContext(contexts[i]);
+        staged[i] = mStore.stage(reader);
+    });
+
+    for (std::size_t i = 0; i < files.size(); ++i)
+        mStaged[files[i].first] = std::move(staged[i]);
+}
+
 void EsmLoader::load(const boost::filesystem::path& filepath, int& index, Loading::Listener* listener)
 {
     const ESM::ReadersCache::BusyItem reader = mReaders.get(static_cast<std::size_t>(index));
 
-    reader->setEncoder(mEncoder);
-    reader->setIndex(index);
-    reader->open(filepath.string());
-    reader->resolveParentFileIndices(mReaders);
-
-    assert(reader->getGameFiles().size() == reader->getParentFileIndices().size());
-    for (std::size_t i = 0, n = reader->getParentFileIndices().size(); i < n; ++i)
-        if (i == static_cast<std::size_t>(reader->getIndex()))
-            throw std::runtime_error("File " + reader->getName() + " asks for parent file "
-                + reader->getGameFiles()[i].name
-                + ", but it is not available or has been loaded in the wrong order. "
-                  "Please run the launcher to fix this issue.");
+    open(*reader, filepath, index);
 
-    mStore.load(*reader, listener, mDialogue);
+    const auto staged = mStaged.find(index);
+    if (staged != mStaged.end())
+    {
+        mStore.load(*reader, std::move(staged->second), listener, mDialogue);
+        mStaged.erase(staged);
+    }
+    else
+        mStore.load(*reader, listener, mDialogue);
 
     if (!mMasterFileFormat.has_value() && (Misc::StringUtils::ciEndsWith(reader->getName(), ".esm")
                                            || Misc::StringUtils::ciEndsWith(reader->getName(), ".omwgame")))
         mMasterFileFormat = reader->getFormat();
 }
 
+void EsmLoader::open(ESM::ESMReader& reader, const boost::filesystem::path& filepath, int index)
+{
+    reader.setEncoder(mEncoder);
+    reader.setIndex(index);
+    reader.open(filepath.string());
+    reader.resolveParentFileIndices(mReaders);
+
+    assert(reader.getGameFiles().size() == reader.getParentFileIndices().size());
+    for (std::size_t i = 0, n = reader.getParentFileIndices().size(); i < n; ++i)
+        if (i == static_cast<std::size_t>(reader.getIndex()))
+            throw std::runtime_error("File " + reader.getName() + " asks for parent file "
+                + reader.getGameFiles()[i].name
+                + ", but it is not available or has been loaded in the wrong order. "
+                  "Please run the launcher to fix this issue.");
+}
+
 } /* namespace MWWorld */
@@ -1,9 +1,13 @@
 #ifndef ESMLOADER_HPP
 #define ESMLOADER_HPP
 
+#include <map>
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include "contentloader.hpp"
+#include "esmstore.hpp"
 
 namespace ToUTF8
 {
@@ -12,6 +16,7 @@ namespace ToUTF8
 
 namespace ESM
 {
+    class ESMReader;
     class ReadersCache;
     struct Dialogue;
 }
@@ -19,14 +24,16 @@ namespace ESM
 namespace MWWorld
 {
 
-class ESMStore;
-
 struct EsmLoader : public ContentLoader
 {
     explicit EsmLoader(MWWorld::ESMStore& store, ESM::ReadersCache& readers, ToUTF8::Utf8Encoder* encoder);
 
     std::optional<int> getMasterFileFormat() const { return mMasterFileFormat; }
 
+    /// Read records of the given content files (index and path) using up to threadsCount threads.
+    /// Following load calls for these files add already read records to the store in the same order.
+    void stage(const std::vector<std::pair<int, boost::filesystem::path>>& files, std::size_t threadsCount);
+
     void load(const boost::filesystem::path& filepath, int& index, Loading::Listener* listener) override;
 
     private:
@@ -35,6 +42,9 @@ struct EsmLoader : public ContentLoader
         ToUTF8::Utf8Encoder* mEncoder;
         ESM::Dialogue* mDialogue;
         std::optional<int> mMasterFileFormat;
+        std::map<int, ESMStore::StagedRecords> mStaged;
+
+        void open(ESM::ESMReader& reader, const boost::filesystem::path& filepath, int index);
 };
 
 } /* namespace MWWorld */
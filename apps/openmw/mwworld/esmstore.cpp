@@ -9,7 +9,6 @@
 #include <components/loadinglistener/loadinglistener.hpp>
 #include <components/lua/configuration.hpp>
 #include <components/misc/algorithm.hpp>
-#include <components/esm3/readerscache.hpp>
 #include <components/esmloader/load.hpp>
 
 #include "../mwmechanics/spelllist.hpp"
@@ -26,25 +25,19 @@ namespace
 
     constexpr std::size_t deletedRefID = std::numeric_limits<std::size_t>::max();
 
-    void readRefs(const ESM::Cell& cell, std::vector<Ref>& refs, std::vector<std::string>& refIDs, ESM::ReadersCache& readers)
+    void readRefs(const ESM::Cell& cell, const MWWorld::Store<ESM::Cell>& cells, std::vector<Ref>& refs,
+        std::vector<std::string>& refIDs)
     {
-        // TODO: we have many similar copies of this code.
-        for (size_t i = 0; i < cell.mContextList.size(); i++)
+        if (const auto* loadedRefs = cells.getLoadedRefs(cell))
         {
-            const std::size_t index = static_cast<std::size_t>(cell.mContextList[i].index);
-            const ESM::ReadersCache::BusyItem reader = readers.get(index);
-            cell.restore(*reader, i);
-            ESM::CellRef ref;
-            ref.mRefNum.unset();
-            bool deleted = false;
-            while (cell.getNextRef(*reader, ref, deleted))
+            for (const auto& [refNum, refId, deleted] : *loadedRefs)
             {
-                if(deleted)
-                    refs.emplace_back(ref.mRefNum, deletedRefID);
-                else if (std::find(cell.mMovedRefs.begin(), cell.mMovedRefs.end(), ref.mRefNum) == cell.mMovedRefs.end())
+                if (deleted)
+                    refs.emplace_back(refNum, deletedRefID);
+                else if (std::find(cell.mMovedRefs.begin(), cell.mMovedRefs.end(), refNum) == cell.mMovedRefs.end())
                 {
-                    refs.emplace_back(ref.mRefNum, refIDs.size());
-                    refIDs.push_back(std::move(ref.mRefID));
+                    refs.emplace_back(refNum, refIDs.size());
+                    refIDs.push_back(refId);
                 }
             }
         }
@@ -165,56 +158,129 @@ void ESMStore::load(ESM::ESMReader &esm, Loading::Listener* listener, ESM::Dialo
             continue;
         }
 
-        // Look up the record type.
-        std::map<int, StoreBase *>::iterator it = mStores.find(n.toInt());
+        loadRecord(esm, n, dialogue);
 
-        if (it == mStores.end()) {
-            if (n.toInt() == ESM::REC_INFO) {
-                if (dialogue)
-                {
-                    dialogue->readInfo(esm, esm.getIndex() != 0);
-                }
-                else
-                {
-                    Log(Debug::Error) << "Error: info record without dialog";
-                    esm.skipRecord();
-                }
-            } else if (n.toInt() == ESM::REC_MGEF) {
-                mMagicEffects.load (esm);
-            } else if (n.toInt() == ESM::REC_SKIL) {
-                mSkills.load (esm);
-            }
-            else if (n.toInt() == ESM::REC_FILT || n.toInt() == ESM::REC_DBGP)
-            {
-                // ignore project file only records
-                esm.skipRecord();
-            }
-            else if (n.toInt() == ESM::REC_LUAL)
+        if (listener != nullptr)
+            listener->setProgress(::EsmLoader::fileProgress * esm.getFileOffset() / esm.getFileSize());
+    }
+}
+
+ESMStore::StagedRecords ESMStore::stage(ESM::ESMReader &esm) const
+{
+    StagedRecords result;
+
+    while (esm.hasMoreRecs())
+    {
+        StagedRecord record;
+        record.mName = esm.getRecName();
+        // Context before the record header to be able to read the whole record again
+        ESM::ESM_Context context = esm.getContext();
+        esm.getRecHeader();
+        if (esm.getRecordFlags() & ESM::FLAG_Ignored)
+        {
+            esm.skipRecord();
+            continue;
+        }
+
+        const auto it = mStores.find(record.mName.toInt());
+        if (it != mStores.end())
+            record.mRecord = it->second->stage(esm);
+
+        if (record.mRecord == nullptr)
+        {
+            record.mContext = std::move(context);
+            esm.skipRecord();
+        }
+
+        result.push_back(std::move(record));
+    }
+
+    return result;
+}
+
+void ESMStore::load(ESM::ESMReader &esm, StagedRecords&& records, Loading::Listener* listener,
+    ESM::Dialogue*& dialogue)
+{
+    if (listener != nullptr)
+        listener->setProgressRange(::EsmLoader::fileProgress);
+
+    mLandTextures.resize(esm.getIndex()+1);
+
+    for (std::size_t i = 0; i < records.size(); ++i)
+    {
+        StagedRecord& record = records[i];
+
+        if (record.mRecord == nullptr)
+        {
+            esm.restoreContext(record.mContext);
+            esm.getRecHeader();
+            loadRecord(esm, record.mName, dialogue);
+        }
+        else
+        {
+            StoreBase& store = *mStores.find(record.mName.toInt())->second;
+            handleLoadedRecord(store, store.loadStaged(*record.mRecord), record.mName, dialogue);
+            record.mRecord.reset();
+        }
+
+        if (listener != nullptr)
+            listener->setProgress(::EsmLoader::fileProgress * (i + 1) / records.size());
+    }
+}
+
+void ESMStore::loadRecord(ESM::ESMReader& esm, ESM::NAME name, ESM::Dialogue*& dialogue)
+{
+    // Look up the record type.
+    std::map<int, StoreBase *>::iterator it = mStores.find(name.toInt());
+
+    if (it == mStores.end()) {
+        if (name.toInt() == ESM::REC_INFO) {
+            if (dialogue)
             {
-                ESM::LuaScriptsCfg cfg;
-                cfg.load(esm);
-                cfg.adjustRefNums(esm);
-                mLuaContent.push_back(std::move(cfg));
+                dialogue->readInfo(esm, esm.getIndex() != 0);
             }
-            else {
-                throw std::runtime_error("Unknown record: " + n.toString());
-            }
-        } else {
-            RecordId id = it->second->load(esm);
-            if (id.mIsDeleted)
+            else
             {
-                it->second->eraseStatic(id.mId);
-                continue;
-            }
-
-            if (n.toInt() == ESM::REC_DIAL) {
-                dialogue = const_cast<ESM::Dialogue*>(mDialogs.find(id.mId));
-            } else {
-                dialogue = nullptr;
+                Log(Debug::Error) << "Error: info record without dialog";
+                esm.skipRecord();
             }
+        } else if (name.toInt() == ESM::REC_MGEF) {
+            mMagicEffects.load (esm);
+        } else if (name.toInt() == ESM::REC_SKIL) {
+            mSkills.load (esm);
         }
-        if (listener != nullptr)
-            listener->setProgress(::EsmLoader::fileProgress * esm.getFileOffset() / esm.getFileSize());
+        else if (name.toInt() == ESM::REC_FILT || name.toInt() == ESM::REC_DBGP)
+        {
+            // ignore project file only records
+            esm.skipRecord();
+        }
+        else if (name.toInt() == ESM::REC_LUAL)
+        {
+            ESM::LuaScriptsCfg cfg;
+            cfg.load(esm);
+            cfg.adjustRefNums(esm);
+            mLuaContent.push_back(std::move(cfg));
+        }
+        else {
+            throw std::runtime_error("Unknown record: " + name.toString());
+        }
+    } else {
+        handleLoadedRecord(*it->second, it->second->load(esm), name, dialogue);
+    }
+}
+
+void ESMStore::handleLoadedRecord(StoreBase& store, const RecordId& id, ESM::NAME name, ESM::Dialogue*& dialogue)
+{
+    if (id.mIsDeleted)
+    {
+        store.eraseStatic(id.mId);
+        return;
+    }
+
+    if (name.toInt() == ESM::REC_DIAL) {
+        dialogue = const_cast<ESM::Dialogue*>(mDialogs.find(id.mId));
+    } else {
+        dialogue = nullptr;
     }
 }
 
@@ -272,24 +338,24 @@ void ESMStore::setUp()
     mDialogs.setUp();
 }
 
-void ESMStore::validateRecords(ESM::ReadersCache& readers)
+void ESMStore::validateRecords()
 {
     validate();
-    countAllCellRefs(readers);
+    countAllCellRefs();
 }
 
-void ESMStore::countAllCellRefs(ESM::ReadersCache& readers)
+void ESMStore::countAllCellRefs()
 {
-    // TODO: We currently need to read entire files here again.
-    // We should consider consolidating or deferring this reading.
+    // References are collected by Store<ESM::Cell> while loading content files, so there is no need to read them again.
     if(!mRefCount.empty())
         return;
     std::vector<Ref> refs;
     std::vector<std::string> refIDs;
     for(auto it = mCells.intBegin(); it != mCells.intEnd(); ++it)
-        readRefs(*it, refs, refIDs, readers);
+        readRefs(*it, mCells, refs, refIDs);
     for(auto it = mCells.extBegin(); it != mCells.extEnd(); ++it)
-        readRefs(*it, refs, refIDs, readers);
+        readRefs(*it, mCells, refs, refIDs);
+    mCells.clearLoadedRefs();
     const auto lessByRefNum = [] (const Ref& l, const Ref& r) { return l.mRefNum < r.mRefNum; };
     std::stable_sort(refs.begin(), refs.end(), lessByRefNum);
     const auto equalByRefNum = [] (const Ref& l, const Ref& r) { return l.mRefNum == r.mRefNum; };
@@ -5,6 +5,7 @@
 #include <stdexcept>
 #include <unordered_map>
 
+#include <components/esm/esmcommon.hpp>
 #include <components/esm/luascripts.hpp>
 #include <components/esm/records.hpp>
 #include "store.hpp"
@@ -19,11 +20,6 @@ namespace MWMechanics
     class SpellList;
 }
 
-namespace ESM
-{
-    class ReadersCache;
-}
-
 namespace MWWorld
 {
     class ESMStore
@@ -94,7 +90,11 @@ namespace MWWorld
         /// Validate entries in store after setup
         void validate();
 
-        void countAllCellRefs(ESM::ReadersCache& readers);
+        void countAllCellRefs();
+
+        void loadRecord(ESM::ESMReader& esm, ESM::NAME name, ESM::Dialogue*& dialogue);
+
+        void handleLoadedRecord(StoreBase& store, const RecordId& id, ESM::NAME name, ESM::Dialogue*& dialogue);
 
         template<class T>
         void removeMissingObjects(Store<T>& store);
@@ -105,6 +105,17 @@ namespace MWWorld
         std::vector<LuaContent> mLuaContent;
 
     public:
+        /// Record of a content file read by stage
+        struct StagedRecord
+        {
+            ESM::NAME mName;
+            /// Is nullptr when the record has to be read again from mContext by load
+            std::unique_ptr<StoreBase::StagedRecord> mRecord;
+            ESM::ESM_Context mContext;
+        };
+
+        using StagedRecords = std::vector<StagedRecord>;
+
         void addOMWScripts(std::string filePath) { mLuaContent.push_back(std::move(filePath)); }
         ESM::LuaScriptsCfg getLuaScriptsCfg() const;
 
@@ -202,6 +213,14 @@ namespace MWWorld
 
         void load(ESM::ESMReader &esm, Loading::Listener* listener, ESM::Dialogue*& dialogue);
 
+        /// Read records of a content file without changing the store. Can be called for different content files
+        /// from multiple threads at the same time.
+        StagedRecords stage(ESM::ESMReader &esm) const;
+
+        /// Add records returned by stage with the same result as load for the same content file. Records depending
+        /// on the store content are read again using esm.
+        void load(ESM::ESMReader &esm, StagedRecords&& records, Loading::Listener* listener, ESM::Dialogue*& dialogue);
+
         template <class T>
         const Store<T> &get() const {
             throw std::runtime_error("Storage for this type not exist");
@@ -268,7 +287,7 @@ namespace MWWorld
         // This method must be called once, after loading all master/plugin files. This can only be done
         //  from the outside, so it must be public.
         void setUp();
-        void validateRecords(ESM::ReadersCache& readers);
+        void validateRecords();
 
         int countSavedGameRecords() const;
 
@@ -12,6 +12,7 @@
 #include <components/settings/settings.hpp>
 #include <components/resource/resourcesystem.hpp>
 #include <components/resource/scenemanager.hpp>
+#include <components/resource/imagemanager.hpp>
 #include <components/sceneutil/positionattitudetransform.hpp>
 #include <components/detournavigator/navigator.hpp>
 #include <components/detournavigator/agentbounds.hpp>
@@ -791,6 +792,12 @@ namespace MWWorld
 
         rendering.getResourceSystem()->setExpiryDelay(Settings::Manager::getFloat("cache expiry delay", "Cells"));
 
+        constexpr std::size_t megabyte = 1024 * 1024;
+        rendering.getResourceSystem()->getSceneManager()->setMaxCacheMemorySize(
+            static_cast<std::size_t>(std::max(0, Settings::Manager::getInt("model cache memory limit", "Cells"))) * megabyte);
+        rendering.getResourceSystem()->getImageManager()->setMaxCacheMemorySize(
+            static_cast<std::size_t>(std::max(0, Settings::Manager::getInt("texture cache memory limit", "Cells"))) * megabyte);
+
         mPreloader->setExpiryDelay(Settings::Manager::getFloat("preload cell expiry delay", "Cells"));
         mPreloader->setMinCacheSize(Settings::Manager::getInt("preload cell cache min", "Cells"));
         mPreloader->setMaxCacheSize(Settings::Manager::getInt("preload cell cache max", "Cells"));
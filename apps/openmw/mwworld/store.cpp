@@ -26,6 +26,15 @@ namespace
         }
         return false;
     }
+
+    template <class T>
+    void appendLoadedRefs(std::vector<T>& target, std::vector<T>&& refs)
+    {
+        if (target.empty())
+            target = std::move(refs);
+        else
+            target.insert(target.end(), std::make_move_iterator(refs.begin()), std::make_move_iterator(refs.end()));
+    }
 }
 
 namespace MWWorld
@@ -166,6 +175,13 @@ namespace MWWorld
         }
         return ptr;
     }
+    template<typename T>
+    struct Store<T>::Staged final : StagedRecord
+    {
+        T mRecord;
+        bool mIsDeleted = false;
+    };
+
     template<typename T>
     RecordId Store<T>::load(ESM::ESMReader &esm)
     {
@@ -173,6 +189,25 @@ namespace MWWorld
         bool isDeleted = false;
 
         record.load(esm, isDeleted);
+
+        return loadRecord(record, isDeleted);
+    }
+    template<typename T>
+    std::unique_ptr<StoreBase::StagedRecord> Store<T>::stage(ESM::ESMReader &esm) const
+    {
+        auto staged = std::make_unique<Staged>();
+        staged->mRecord.load(esm, staged->mIsDeleted);
+        return staged;
+    }
+    template<typename T>
+    RecordId Store<T>::loadStaged(StagedRecord& record)
+    {
+        Staged& staged = static_cast<Staged&>(record);
+        return loadRecord(staged.mRecord, staged.mIsDeleted);
+    }
+    template<typename T>
+    RecordId Store<T>::loadRecord(T& record, bool isDeleted)
+    {
         Misc::StringUtils::lowerCaseInPlace(record.mId); // TODO: remove this line once we have ported our remaining code base to lowercase on lookup
 
         std::pair<typename Static::iterator, bool> inserted = mStatic.insert_or_assign(record.mId, record);
@@ -454,7 +489,7 @@ namespace MWWorld
     }
 
     // this method *must* be called right after esm3.loadCell()
-    void Store<ESM::Cell>::handleMovedCellRefs(ESM::ESMReader& esm, ESM::Cell* cell)
+    void Store<ESM::Cell>::handleMovedCellRefs(ESM::ESMReader& esm, ESM::Cell* cell, std::vector<LoadedRef>& loadedRefs)
     {
         ESM::CellRef ref;
         ESM::MovedCellRef cMRef;
@@ -468,10 +503,13 @@ namespace MWWorld
         //
         // Get regular moved reference data. Adapted from CellStore::loadRefs. Maybe we can optimize the following
         //  implementation when the oher implementation works as well.
-        while (ESM::Cell::getNextRef(esm, ref, deleted, cMRef, moved, ESM::Cell::GetNextRefMode::LoadOnlyMoved))
+        while (ESM::Cell::getNextRef(esm, ref, deleted, cMRef, moved, ESM::Cell::GetNextRefMode::LoadAll))
         {
             if (!moved)
+            {
+                loadedRefs.push_back(LoadedRef {ref.mRefNum, std::move(ref.mRefID), deleted});
                 continue;
+            }
 
             ESM::Cell *cellAlt = const_cast<ESM::Cell*>(searchOrCreate(cMRef.mTarget[0], cMRef.mTarget[1]));
 
@@ -491,6 +529,32 @@ namespace MWWorld
 
         esm.restoreContext(ctx);
     }
+
+    void Store<ESM::Cell>::readRefs(ESM::ESMReader& esm, std::vector<LoadedRef>& loadedRefs)
+    {
+        const ESM::ESM_Context ctx = esm.getContext();
+
+        ESM::CellRef ref;
+        bool deleted = false;
+        while (ESM::Cell::getNextRef(esm, ref, deleted))
+            loadedRefs.push_back(LoadedRef {ref.mRefNum, std::move(ref.mRefID), deleted});
+
+        esm.restoreContext(ctx);
+    }
+
+    const std::vector<Store<ESM::Cell>::LoadedRef>* Store<ESM::Cell>::getLoadedRefs(const ESM::Cell& cell) const
+    {
+        const auto it = mLoadedRefs.find(&cell);
+        if (it == mLoadedRefs.end())
+            return nullptr;
+        return &it->second;
+    }
+
+    void Store<ESM::Cell>::clearLoadedRefs()
+    {
+        mLoadedRefs.clear();
+    }
+
     const ESM::Cell* Store<ESM::Cell>::search(std::string_view id) const
     {
         DynamicInt::const_iterator it = mInt.find(id);
@@ -597,6 +661,7 @@ namespace MWWorld
         // All cells have a name record, even nameless exterior cells.
         ESM::Cell cell;
         bool isDeleted = false;
+        std::vector<LoadedRef> loadedRefs;
 
         // Load the (x,y) coordinates of the cell, if it is an exterior cell,
         // so we can find the cell we need to merge with
@@ -608,17 +673,22 @@ namespace MWWorld
             ESM::Cell *oldcell = const_cast<ESM::Cell*>(search(cell.mName));
             if (oldcell) {
                 // merge new cell into old cell
-                // push the new references on the list of references to manage (saveContext = true)
                 oldcell->mData = cell.mData;
                 oldcell->mName = cell.mName; // merge name just to be sure (ID will be the same, but case could have been changed)
-                oldcell->loadCell(esm, true);
+                oldcell->loadCell(esm, false);
+                readRefs(esm, loadedRefs);
+                // push the new references on the list of references to manage
+                oldcell->postLoad(esm);
             } else
             {
                 // spawn a new cell
-                cell.loadCell(esm, true);
+                cell.loadCell(esm, false);
+                readRefs(esm, loadedRefs);
+                cell.postLoad(esm);
 
-                mInt[cell.mName] = cell;
+                oldcell = &(mInt[cell.mName] = cell);
             }
+            appendLoadedRefs(mLoadedRefs[oldcell], std::move(loadedRefs));
         }
         else
         {
@@ -631,11 +701,13 @@ namespace MWWorld
                 oldcell->loadCell(esm, false);
 
                 // handle moved ref (MVRF) subrecords
-                handleMovedCellRefs (esm, &cell);
+                handleMovedCellRefs (esm, &cell, loadedRefs);
 
                 // push the new references on the list of references to manage
                 oldcell->postLoad(esm);
 
+                appendLoadedRefs(mLoadedRefs[oldcell], std::move(loadedRefs));
+
                 // merge lists of leased references, use newer data in case of conflict
                 for (ESM::MovedCellRefTracker::const_iterator it = cell.mMovedRefs.begin(); it != cell.mMovedRefs.end(); ++it) {
                     // remove reference from current leased ref tracker and add it to new cell
@@ -666,12 +738,13 @@ namespace MWWorld
                 cell.loadCell(esm, false);
 
                 // handle moved ref (MVRF) subrecords
-                handleMovedCellRefs (esm, &cell);
+                handleMovedCellRefs (esm, &cell, loadedRefs);
 
                 // push the new references on the list of references to manage
                 cell.postLoad(esm);
 
-                mExt[std::make_pair(cell.mData.mX, cell.mData.mY)] = cell;
+                const ESM::Cell* const newCell = &(mExt[std::make_pair(cell.mData.mX, cell.mData.mY)] = cell);
+                appendLoadedRefs(mLoadedRefs[newCell], std::move(loadedRefs));
             }
         }
 
@@ -7,6 +7,7 @@
 #include <map>
 #include <unordered_map>
 #include <set>
+#include <stdexcept>
 
 #include <components/esm/records.hpp>
 #include <components/misc/strings/algorithm.hpp>
@@ -37,6 +38,12 @@ namespace MWWorld
     class StoreBase
     {
     public:
+        /// Record read from a content file but not added to the store yet
+        struct StagedRecord
+        {
+            virtual ~StagedRecord() = default;
+        };
+
         virtual ~StoreBase() {}
 
         virtual void setUp() {}
@@ -48,6 +55,16 @@ namespace MWWorld
         virtual int getDynamicSize() const { return 0; }
         virtual RecordId load(ESM::ESMReader &esm) = 0;
 
+        /// Read a record without changing the store, safe to call from multiple threads. Returns nullptr if the
+        /// record depends on the store content and has to be read by load in the content files order.
+        virtual std::unique_ptr<StagedRecord> stage(ESM::ESMReader &esm) const { return nullptr; }
+
+        /// Add a record returned by stage the same way as load does.
+        virtual RecordId loadStaged(StagedRecord& record)
+        {
+            throw std::logic_error("Staged records are not supported by the store");
+        }
+
         virtual bool eraseStatic(std::string_view id) { return false; }
         virtual void clearDynamic() {}
 
@@ -163,8 +180,12 @@ namespace MWWorld
         typedef std::unordered_map<std::string, T, Misc::StringUtils::CiHash, Misc::StringUtils::CiEqual> Dynamic;
         Dynamic mDynamic;
 
+        struct Staged;
+
         friend class ESMStore;
 
+        RecordId loadRecord(T& record, bool isDeleted);
+
     public:
         Store();
         Store(const Store<T> &orig);
@@ -206,6 +227,8 @@ namespace MWWorld
         bool erase(const T &item);
 
         RecordId load(ESM::ESMReader &esm) override;
+        std::unique_ptr<StagedRecord> stage(ESM::ESMReader &esm) const override;
+        RecordId loadStaged(StagedRecord& record) override;
         void write(ESM::ESMWriter& writer, Loading::Listener& progress) const override;
         RecordId read(ESM::ESMReader& reader, bool overrideOnly = false) override;
     };
@@ -284,6 +307,16 @@ namespace MWWorld
     template <>
     class Store<ESM::Cell> : public StoreBase
     {
+    public:
+        // Reference read from a content file when loading a cell record
+        struct LoadedRef
+        {
+            ESM::RefNum mRefNum;
+            std::string mRefId;
+            bool mDeleted;
+        };
+
+    private:
         struct DynamicExtCmp
         {
             bool operator()(const std::pair<int, int> &left, const std::pair<int, int> &right) const {
@@ -312,8 +345,12 @@ namespace MWWorld
         DynamicInt mDynamicInt;
         DynamicExt mDynamicExt;
 
+        // References are collected while loading cells to avoid reading all content files again to count them
+        std::unordered_map<const ESM::Cell*, std::vector<LoadedRef>> mLoadedRefs;
+
         const ESM::Cell *search(const ESM::Cell &cell) const;
-        void handleMovedCellRefs(ESM::ESMReader& esm, ESM::Cell* cell);
+        void handleMovedCellRefs(ESM::ESMReader& esm, ESM::Cell* cell, std::vector<LoadedRef>& loadedRefs);
+        void readRefs(ESM::ESMReader& esm, std::vector<LoadedRef>& loadedRefs);
 
     public:
         typedef SharedIterator<ESM::Cell> iterator;
@@ -331,6 +368,12 @@ namespace MWWorld
 
         RecordId load(ESM::ESMReader &esm) override;
 
+        /// Not moved references of the cell from all content files in load order. Moved references are stored
+        /// in mLeasedRefs of the target cell.
+        const std::vector<LoadedRef>* getLoadedRefs(const ESM::Cell& cell) const;
+
+        void clearLoadedRefs();
+
         iterator intBegin() const;
         iterator intEnd() const;
         iterator extBegin() const;
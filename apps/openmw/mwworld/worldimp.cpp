@@ -1,5 +1,7 @@
 #include "worldimp.hpp"
 
+#include <array>
+
 #include <osg/Group>
 #include <osg/ComputeBoundsVisitor>
 #include <osg/Timer>
@@ -173,7 +175,7 @@ namespace MWWorld
         fillGlobalVariables();
 
         mStore.setUp();
-        mStore.validateRecords(mReaders);
+        mStore.validateRecords();
         mStore.movePlayerRecord();
 
         mSwimHeightScale = mStore.get<ESM::GameSetting>().find("fSwimHeightScale")->mValue.getFloat();
@@ -709,13 +711,17 @@ namespace MWWorld
 
         for (CellStore* cellstore : mWorldScene->getActiveCells())
         {
-            // TODO: caching still doesn't work efficiently here (only works for the one CellStore that the reference is in)
             Ptr ptr = mCells.getPtr (lowerCaseName, *cellstore, false);
 
             if (!ptr.isEmpty())
+            {
+                ++mSearchPtrHits;
                 return ptr;
+            }
         }
 
+        ++mSearchPtrMisses;
+
         if (!activeOnly)
         {
             ret = mCells.getPtr (lowerCaseName);
@@ -1259,6 +1265,8 @@ namespace MWWorld
             mWorldScene->removeFromPagedRefs(newPtr);
         }
 
+        MWBase::Environment::get().getMechanicsManager()->updatePosition(newPtr);
+
         return newPtr;
     }
 
@@ -2930,15 +2938,31 @@ namespace MWWorld
         GameContentLoader gameContentLoader;
         EsmLoader esmLoader(mStore, mReaders, encoder);
 
-        gameContentLoader.addLoader(".esm", esmLoader);
-        gameContentLoader.addLoader(".esp", esmLoader);
-        gameContentLoader.addLoader(".omwgame", esmLoader);
-        gameContentLoader.addLoader(".omwaddon", esmLoader);
-        gameContentLoader.addLoader(".project", esmLoader);
+        const std::array<std::string_view, 5> esmExtensions {".esm", ".esp", ".omwgame", ".omwaddon", ".project"};
+        for (std::string_view extension : esmExtensions)
+            gameContentLoader.addLoader(std::string(extension), esmLoader);
 
         OMWScriptsLoader omwScriptsLoader(mStore);
         gameContentLoader.addLoader(".omwscripts", omwScriptsLoader);
 
+        const int threadsCount = Settings::Manager::getInt("content loading threads", "General");
+        if (threadsCount > 1)
+        {
+            // Read records of all game files in parallel, they are still added to the store in the load order
+            std::vector<std::pair<int, boost::filesystem::path>> esmFiles;
+            for (std::size_t i = 0; i < content.size(); ++i)
+            {
+                boost::filesystem::path filename(content[i]);
+                const std::string extension = Misc::StringUtils::lowerCase(filename.extension().string());
+                if (std::find(esmExtensions.begin(), esmExtensions.end(), extension) == esmExtensions.end())
+                    continue;
+                const Files::MultiDirCollection& col = fileCollections.getCollection(filename.extension().string());
+                if (col.doesExist(content[i]))
+                    esmFiles.emplace_back(static_cast<int>(i), col.getPath(content[i]));
+            }
+            esmLoader.stage(esmFiles, static_cast<std::size_t>(threadsCount));
+        }
+
         int idx = 0;
         for (const std::string &file : content)
         {
@@ -3981,6 +4005,8 @@ namespace MWWorld
     {
         mNavigator->reportStats(frameNumber, stats);
         mPhysics->reportStats(frameNumber, stats);
+        stats.setAttribute(frameNumber, "World SearchPtrHits", mSearchPtrHits);
+        stats.setAttribute(frameNumber, "World SearchPtrMisses", mSearchPtrMisses);
     }
 
     void World::updateSkyDate()
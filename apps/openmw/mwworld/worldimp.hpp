@@ -139,6 +139,10 @@ namespace MWWorld
 
             float mSimulationTimeScale = 1.0;
 
+            // searchPtr calls resolved by id lookup in active cells and calls falling back to slower searches
+            std::size_t mSearchPtrHits = 0;
+            std::size_t mSearchPtrMisses = 0;
+
             // not implemented
             World (const World&);
             World& operator= (const World&);
@@ -0,0 +1,71 @@
+#include <components/bsa/decompressedfilecache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace Bsa;
+
+    DecompressedFile makeFile(std::size_t size)
+    {
+        return std::make_shared<const std::vector<char>>(size);
+    }
+
+    struct BsaDecompressedFileCacheTest : Test
+    {
+        const int mArchive = 0;
+        const int mOtherArchive = 1;
+    };
+
+    TEST_F(BsaDecompressedFileCacheTest, get_should_return_put_file)
+    {
+        DecompressedFileCache cache(10);
+        const DecompressedFile file = makeFile(4);
+        cache.put(&mArchive, 1, file);
+        EXPECT_EQ(cache.get(&mArchive, 1), file);
+        EXPECT_EQ(cache.get(&mArchive, 2).get(), nullptr);
+        EXPECT_EQ(cache.get(&mOtherArchive, 1).get(), nullptr);
+        const DecompressedFileCache::Stats stats = cache.getStats();
+        EXPECT_EQ(stats.mSize, 4u);
+        EXPECT_EQ(stats.mCount, 1u);
+        EXPECT_EQ(stats.mHits, 1u);
+        EXPECT_EQ(stats.mMisses, 2u);
+    }
+
+    TEST_F(BsaDecompressedFileCacheTest, put_should_skip_file_larger_than_cache)
+    {
+        DecompressedFileCache cache(10);
+        cache.put(&mArchive, 1, makeFile(11));
+        EXPECT_EQ(cache.get(&mArchive, 1).get(), nullptr);
+        EXPECT_EQ(cache.getStats().mSize, 0u);
+    }
+
+    TEST_F(BsaDecompressedFileCacheTest, put_should_evict_least_recently_used_files_to_stay_within_size)
+    {
+        DecompressedFileCache cache(10);
+        cache.put(&mArchive, 1, makeFile(4));
+        cache.put(&mArchive, 2, makeFile(4));
+        cache.get(&mArchive, 1);
+        cache.put(&mArchive, 3, makeFile(4));
+        EXPECT_NE(cache.get(&mArchive, 1).get(), nullptr);
+        EXPECT_EQ(cache.get(&mArchive, 2).get(), nullptr);
+        EXPECT_NE(cache.get(&mArchive, 3).get(), nullptr);
+        EXPECT_EQ(cache.getStats().mSize, 8u);
+        EXPECT_EQ(cache.getStats().mCount, 2u);
+    }
+
+    TEST_F(BsaDecompressedFileCacheTest, remove_should_drop_only_files_of_given_archive)
+    {
+        DecompressedFileCache cache(10);
+        cache.put(&mArchive, 1, makeFile(4));
+        cache.put(&mOtherArchive, 1, makeFile(4));
+        cache.remove(&mArchive);
+        EXPECT_EQ(cache.get(&mArchive, 1).get(), nullptr);
+        EXPECT_NE(cache.get(&mOtherArchive, 1).get(), nullptr);
+        EXPECT_EQ(cache.getStats().mSize, 4u);
+    }
+}
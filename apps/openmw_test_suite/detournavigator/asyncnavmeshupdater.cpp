@@ -153,6 +153,40 @@ namespace
         EXPECT_EQ(tile->mVersion, navMeshFormatVersion);
     }
 
+    TEST_F(DetourNavigatorAsyncNavMeshUpdaterTest, post_should_write_generated_tiles_to_db_in_single_transaction)
+    {
+        mRecastMeshManager.setWorldspace(mWorldspace);
+        for (int x = -1; x <= 1; ++x)
+            addHeightFieldPlane(mRecastMeshManager, osg::Vec2i(x, 0));
+        auto db = std::make_unique<NavMeshDb>(":memory:", std::numeric_limits<std::uint64_t>::max());
+        NavMeshDb* const dbPtr = db.get();
+        mSettings.mDbWriteBatchSize = 1000;
+        mSettings.mDbWriteBatchInterval = std::chrono::hours(1);
+        AsyncNavMeshUpdater updater(mSettings, mRecastMeshManager, mOffMeshConnectionsManager, std::move(db));
+        const auto navMeshCacheItem = std::make_shared<GuardedNavMeshCacheItem>(makeEmptyNavMesh(mSettings), 1);
+        std::map<TilePosition, ChangeType> changedTiles;
+        for (int x = -1; x <= 1; ++x)
+            changedTiles.emplace(TilePosition {x, 0}, ChangeType::add);
+        updater.post(mAgentBounds, navMeshCacheItem, mPlayerTile, mWorldspace, changedTiles);
+        updater.wait(mListener, WaitConditionType::allJobsDone);
+        updater.stop();
+        const auto stats = updater.getStats();
+        ASSERT_TRUE(stats.mDb.has_value());
+        EXPECT_EQ(stats.mDb->mWrittenTiles, changedTiles.size());
+        EXPECT_EQ(stats.mDb->mCommits, 1);
+        for (const auto& [tilePosition, changeType] : changedTiles)
+        {
+            const auto recastMesh = mRecastMeshManager.getMesh(mWorldspace, tilePosition);
+            ASSERT_NE(recastMesh, nullptr);
+            ShapeId nextShapeId {1};
+            const std::vector<DbRefGeometryObject> objects = makeDbRefGeometryObjects(recastMesh->getMeshSources(),
+                [&] (const MeshSource& v) { return resolveMeshSource(*dbPtr, v, nextShapeId); });
+            const auto tile = dbPtr->findTile(mWorldspace, tilePosition,
+                                              serialize(mSettings.mRecast, mAgentBounds, *recastMesh, objects));
+            EXPECT_TRUE(tile.has_value());
+        }
+    }
+
     TEST_F(DetourNavigatorAsyncNavMeshUpdaterTest, post_when_writing_to_db_disabled_should_not_write_tiles)
     {
         mRecastMeshManager.setWorldspace(mWorldspace);
@@ -231,6 +265,34 @@ namespace
         }
     }
 
+    TEST_F(DetourNavigatorAsyncNavMeshUpdaterTest, post_should_read_db_tile_of_previous_supported_format_version)
+    {
+        mRecastMeshManager.setWorldspace(mWorldspace);
+        addHeightFieldPlane(mRecastMeshManager);
+        mSettings.mMaxNavMeshTilesCacheSize = 0;
+        auto db = std::make_unique<NavMeshDb>(":memory:", std::numeric_limits<std::uint64_t>::max());
+        const TilePosition tilePosition {0, 0};
+        const auto recastMesh = mRecastMeshManager.getMesh(mWorldspace, tilePosition);
+        ASSERT_NE(recastMesh, nullptr);
+        const auto data = prepareNavMeshTileData(*recastMesh, tilePosition, mAgentBounds, mSettings.mRecast);
+        ASSERT_NE(data, nullptr);
+        const TileId tileId {1};
+        data->mUserId = static_cast<unsigned>(tileId);
+        db->insertTile(tileId, mWorldspace, tilePosition, TileVersion {minNavMeshFormatVersion},
+            serialize(mSettings.mRecast, mAgentBounds, *recastMesh, std::vector<DbRefGeometryObject>()),
+            serialize(*data));
+        AsyncNavMeshUpdater updater(mSettings, mRecastMeshManager, mOffMeshConnectionsManager, std::move(db));
+        const auto navMeshCacheItem = std::make_shared<GuardedNavMeshCacheItem>(makeEmptyNavMesh(mSettings), 1);
+        const std::map<TilePosition, ChangeType> changedTiles {{tilePosition, ChangeType::add}};
+        updater.post(mAgentBounds, navMeshCacheItem, mPlayerTile, mWorldspace, changedTiles);
+        updater.wait(mListener, WaitConditionType::allJobsDone);
+        updater.stop();
+        const auto stats = updater.getStats();
+        ASSERT_TRUE(stats.mDb.has_value());
+        EXPECT_EQ(stats.mDb->mGetTileCount, 1);
+        EXPECT_EQ(stats.mDbGetTileHits, 1);
+    }
+
     TEST_F(DetourNavigatorAsyncNavMeshUpdaterTest, on_changing_player_tile_post_should_remove_tiles_out_of_range)
     {
         mRecastMeshManager.setWorldspace(mWorldspace);
@@ -188,6 +188,62 @@ namespace
         )) << mPath;
     }
 
+    TEST_F(DetourNavigatorNavigatorTest, update_then_find_path_async_should_return_path)
+    {
+        constexpr std::array<float, 5 * 5> heightfieldData {{
+            0,   0,    0,    0,    0,
+            0, -25,  -25,  -25,  -25,
+            0, -25, -100, -100, -100,
+            0, -25, -100, -100, -100,
+            0, -25, -100, -100, -100,
+        }};
+        const HeightfieldSurface surface = makeSquareHeightfieldSurface(heightfieldData);
+        const int cellSize = mHeightfieldTileSize * (surface.mSize - 1);
+
+        mNavigator->addAgent(mAgentBounds);
+        mNavigator->addHeightfield(mCellPosition, cellSize, surface);
+        mNavigator->update(mPlayerPosition);
+        mNavigator->wait(mListener, WaitConditionType::requiredTilesPresent);
+
+        const PathResult result = findPathAsync(*mNavigator, mAgentBounds, mStepSize, mStart, mEnd, Flag_walk,
+            mAreaCosts, mEndTolerance).get();
+
+        EXPECT_EQ(result.mStatus, Status::Success);
+
+        EXPECT_THAT(result.mPath, ElementsAre(
+            Vec3fEq(56.66666412353515625, 460, 1.99998295307159423828125),
+            Vec3fEq(76.70135498046875, 439.965301513671875, -0.9659786224365234375),
+            Vec3fEq(96.73604583740234375, 419.93060302734375, -4.002437114715576171875),
+            Vec3fEq(116.770751953125, 399.89593505859375, -7.0388965606689453125),
+            Vec3fEq(136.8054351806640625, 379.861236572265625, -11.5593852996826171875),
+            Vec3fEq(156.840118408203125, 359.826568603515625, -20.7333812713623046875),
+            Vec3fEq(176.8748016357421875, 339.7918701171875, -34.014251708984375),
+            Vec3fEq(196.90948486328125, 319.757171630859375, -47.2951202392578125),
+            Vec3fEq(216.944183349609375, 299.722503662109375, -59.4111785888671875),
+            Vec3fEq(236.9788665771484375, 279.68780517578125, -65.76436614990234375),
+            Vec3fEq(257.0135498046875, 259.65313720703125, -68.12311553955078125),
+            Vec3fEq(277.048248291015625, 239.618438720703125, -66.5666656494140625),
+            Vec3fEq(297.082916259765625, 219.583740234375, -60.305889129638671875),
+            Vec3fEq(317.11761474609375, 199.549041748046875, -49.181324005126953125),
+            Vec3fEq(337.15228271484375, 179.5143585205078125, -35.742702484130859375),
+            Vec3fEq(357.186981201171875, 159.47967529296875, -22.304073333740234375),
+            Vec3fEq(377.221649169921875, 139.4449920654296875, -12.65070629119873046875),
+            Vec3fEq(397.25634765625, 119.41030120849609375, -7.41098117828369140625),
+            Vec3fEq(417.291046142578125, 99.3756103515625, -4.382833957672119140625),
+            Vec3fEq(437.325714111328125, 79.340911865234375, -1.354687213897705078125),
+            Vec3fEq(457.360443115234375, 59.3062286376953125, 1.624610424041748046875),
+            Vec3fEq(460, 56.66666412353515625, 1.99998295307159423828125)
+        )) << result.mPath;
+    }
+
+    TEST_F(DetourNavigatorNavigatorTest, find_path_async_for_empty_should_return_navmesh_not_found)
+    {
+        const PathResult result = findPathAsync(*mNavigator, mAgentBounds, mStepSize, mStart, mEnd, Flag_walk,
+            mAreaCosts, mEndTolerance).get();
+        EXPECT_EQ(result.mStatus, Status::NavMeshNotFound);
+        EXPECT_THAT(result.mPath, IsEmpty());
+    }
+
     TEST_F(DetourNavigatorNavigatorTest, add_object_should_change_navmesh)
     {
         const std::array<float, 5 * 5> heightfieldData {{
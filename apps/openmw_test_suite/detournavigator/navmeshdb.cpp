@@ -168,6 +168,28 @@ namespace
                           -1 <= x && x <= 1 && -1 <= y && y <= 1) << "x=" << x << " y=" << y;
     }
 
+    TEST_F(DetourNavigatorNavMeshDbTest, make_dictionary_for_empty_db_should_return_zero)
+    {
+        EXPECT_EQ(mDb.makeDictionary(10), DictionaryId {0});
+        EXPECT_EQ(mDb.getDictionaryId(), DictionaryId {0});
+    }
+
+    TEST_F(DetourNavigatorNavMeshDbTest, tiles_should_be_readable_after_recompression_with_dictionary)
+    {
+        const TileVersion version {1};
+        const auto first = insertTile(TileId {1}, version);
+        ASSERT_EQ(mDb.makeDictionary(10), DictionaryId {1});
+        const auto second = insertTile(TileId {2}, version);
+        EXPECT_EQ(mDb.recompressTiles(), 1);
+        EXPECT_EQ(mDb.recompressTiles(), 0);
+        for (const Tile& tile : {first, second})
+        {
+            const auto result = mDb.getTileData(tile.mWorldspace, tile.mTilePosition, tile.mInput);
+            ASSERT_TRUE(result.has_value());
+            EXPECT_EQ(result->mData, tile.mData);
+        }
+    }
+
     TEST_F(DetourNavigatorNavMeshDbTest, should_support_file_size_limit)
     {
         mDb = NavMeshDb(":memory:", 4096);
@@ -198,6 +198,30 @@ namespace
         EXPECT_FALSE(cache.get(mAgentBounds, mTilePosition, unexistentRecastMesh));
     }
 
+    TEST_F(DetourNavigatorNavMeshTilesCacheTest, get_for_recast_mesh_with_same_content_should_return_cached_value)
+    {
+        const std::size_t maxSize = mRecastMeshSize + mPreparedNavMeshDataSize;
+        NavMeshTilesCache cache(maxSize);
+        const RecastMesh sameRecastMesh(mGeneration + 1, mRevision + 1, makeMesh(), mWater, mHeightfields,
+            mFlatHeightfields, mSources);
+        ASSERT_EQ(mRecastMesh.getHash(), sameRecastMesh.getHash());
+
+        cache.set(mAgentBounds, mTilePosition, mRecastMesh, std::move(mPreparedNavMeshData));
+        EXPECT_TRUE(cache.get(mAgentBounds, mTilePosition, sameRecastMesh));
+    }
+
+    TEST_F(DetourNavigatorNavMeshTilesCacheTest, recast_meshes_with_different_content_should_have_different_hash)
+    {
+        const std::vector<CellWater> water(1, CellWater {osg::Vec2i(), Water {1, 0.0f}});
+        const std::vector<FlatHeightfield> flatHeightfields(1, FlatHeightfield {osg::Vec2i(), 1, 0.0f});
+        const RecastMesh withWater(mGeneration, mRevision, mMesh, water, mHeightfields, mFlatHeightfields, mSources);
+        const RecastMesh withFlatHeightfield(mGeneration, mRevision, mMesh, mWater, mHeightfields, flatHeightfields,
+            mSources);
+        EXPECT_NE(mRecastMesh.getHash(), withWater.getHash());
+        EXPECT_NE(mRecastMesh.getHash(), withFlatHeightfield.getHash());
+        EXPECT_NE(withWater.getHash(), withFlatHeightfield.getHash());
+    }
+
     TEST_F(DetourNavigatorNavMeshTilesCacheTest, set_should_replace_unused_value)
     {
         const std::size_t maxSize = mRecastMeshWithWaterSize + mPreparedNavMeshDataSize;
@@ -0,0 +1,129 @@
+#include <components/detournavigator/pathcache.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <map>
+#include <optional>
+
+namespace
+{
+    using namespace testing;
+    using namespace DetourNavigator;
+
+    struct DetourNavigatorPathCacheTest : Test
+    {
+        const PathCacheKey mKey {1, 3, Flag_walk, AreaCosts {}};
+        const std::vector<dtPolyRef> mPath {1, 2, 3};
+        const TilePosition mTile {0, 0};
+        const Version mVersion {1, 1};
+        std::map<TilePosition, Version> mTileVersions {{mTile, mVersion}};
+
+        auto getTileVersion()
+        {
+            return [this] (const TilePosition& position) -> std::optional<Version>
+            {
+                const auto it = mTileVersions.find(position);
+                if (it == mTileVersions.end())
+                    return std::nullopt;
+                return it->second;
+            };
+        }
+
+        PathCache::TileVersions makeTiles() const
+        {
+            return PathCache::TileVersions {{mTile, mVersion}};
+        }
+    };
+
+    TEST_F(DetourNavigatorPathCacheTest, get_for_empty_cache_should_return_nullptr)
+    {
+        PathCache cache(1);
+        EXPECT_EQ(cache.get(mKey, getTileVersion()), nullptr);
+    }
+
+    TEST_F(DetourNavigatorPathCacheTest, get_should_return_cached_path)
+    {
+        PathCache cache(1);
+        cache.set(mKey, std::vector<dtPolyRef>(mPath), makeTiles());
+        const std::vector<dtPolyRef>* const result = cache.get(mKey, getTileVersion());
+        ASSERT_NE(result, nullptr);
+        EXPECT_EQ(*result, mPath);
+    }
+
+    TEST_F(DetourNavigatorPathCacheTest, get_for_zero_max_size_should_return_nullptr)
+    {
+        PathCache cache(0);
+        cache.set(mKey, std::vector<dtPolyRef>(mPath), makeTiles());
+        EXPECT_EQ(cache.get(mKey, getTileVersion()), nullptr);
+        EXPECT_EQ(cache.getStats().mSize, 0u);
+    }
+
+    TEST_F(DetourNavigatorPathCacheTest, set_for_path_not_reaching_end_should_not_cache)
+    {
+        PathCache cache(1);
+        cache.set(mKey, std::vector<dtPolyRef> {1, 2}, makeTiles());
+        EXPECT_EQ(cache.get(mKey, getTileVersion()), nullptr);
+        EXPECT_EQ(cache.getStats().mSize, 0u);
+    }
+
+    TEST_F(DetourNavigatorPathCacheTest, get_for_different_flags_should_return_nullptr)
+    {
+        PathCache cache(1);
+        cache.set(mKey, std::vector<dtPolyRef>(mPath), makeTiles());
+        const PathCacheKey key {mKey.mStart, mKey.mEnd, Flag_swim, mKey.mAreaCosts};
+        EXPECT_EQ(cache.get(key, getTileVersion()), nullptr);
+    }
+
+    TEST_F(DetourNavigatorPathCacheTest, get_after_tile_version_change_should_return_nullptr)
+    {
+        PathCache cache(1);
+        cache.set(mKey, std::vector<dtPolyRef>(mPath), makeTiles());
+        mTileVersions[mTile] = Version {1, 2};
+        EXPECT_EQ(cache.get(mKey, getTileVersion()), nullptr);
+        EXPECT_EQ(cache.getStats().mSize, 0u);
+    }
+
+    TEST_F(DetourNavigatorPathCacheTest, get_after_tile_removal_should_return_nullptr)
+    {
+        PathCache cache(1);
+        cache.set(mKey, std::vector<dtPolyRef>(mPath), makeTiles());
+        mTileVersions.clear();
+        EXPECT_EQ(cache.get(mKey, getTileVersion()), nullptr);
+    }
+
+    TEST_F(DetourNavigatorPathCacheTest, get_after_other_tile_change_should_return_cached_path)
+    {
+        PathCache cache(1);
+        cache.set(mKey, std::vector<dtPolyRef>(mPath), makeTiles());
+        mTileVersions[TilePosition(1, 0)] = Version {2, 1};
+        EXPECT_NE(cache.get(mKey, getTileVersion()), nullptr);
+    }
+
+    TEST_F(DetourNavigatorPathCacheTest, set_over_max_size_should_remove_least_recently_used)
+    {
+        PathCache cache(2);
+        const PathCacheKey key1 {1, 2, Flag_walk, AreaCosts {}};
+        const PathCacheKey key2 {1, 3, Flag_walk, AreaCosts {}};
+        const PathCacheKey key3 {1, 4, Flag_walk, AreaCosts {}};
+        cache.set(key1, std::vector<dtPolyRef> {1, 2}, makeTiles());
+        cache.set(key2, std::vector<dtPolyRef> {1, 3}, makeTiles());
+        EXPECT_NE(cache.get(key1, getTileVersion()), nullptr);
+        cache.set(key3, std::vector<dtPolyRef> {1, 4}, makeTiles());
+        EXPECT_NE(cache.get(key1, getTileVersion()), nullptr);
+        EXPECT_EQ(cache.get(key2, getTileVersion()), nullptr);
+        EXPECT_NE(cache.get(key3, getTileVersion()), nullptr);
+    }
+
+    TEST_F(DetourNavigatorPathCacheTest, get_should_count_hits)
+    {
+        PathCache cache(1);
+        cache.set(mKey, std::vector<dtPolyRef>(mPath), makeTiles());
+        cache.get(mKey, getTileVersion());
+        cache.get(PathCacheKey {2, 3, Flag_walk, AreaCosts {}}, getTileVersion());
+        const PathCache::Stats stats = cache.getStats();
+        EXPECT_EQ(stats.mSize, 1u);
+        EXPECT_EQ(stats.mHitCount, 1u);
+        EXPECT_EQ(stats.mGetCount, 2u);
+    }
+}
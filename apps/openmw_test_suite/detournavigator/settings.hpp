@@ -35,13 +35,17 @@ namespace DetourNavigator
             result.mRecast.mTileSize = 64;
             result.mWaitUntilMinDistanceToPlayer = std::numeric_limits<int>::max();
             result.mAsyncNavMeshUpdaterThreads = 1;
+            result.mAsyncPathfinderThreads = 1;
             result.mMaxNavMeshTilesCacheSize = 1024 * 1024;
             result.mDetour.mMaxPolygonPathSize = 1024;
             result.mDetour.mMaxSmoothPathSize = 1024;
+            result.mDetour.mMaxPathCacheSize = 16;
             result.mDetour.mMaxPolys = 4096;
             result.mMaxTilesNumber = 512;
             result.mMinUpdateInterval = std::chrono::milliseconds(50);
             result.mWriteToNavMeshDb = true;
+            result.mDbWriteBatchSize = 1;
+            result.mDbWriteBatchInterval = std::chrono::milliseconds(0);
             return result;
         }
     }
@@ -28,4 +28,33 @@ namespace
         const std::vector<std::byte> decompressed = decompress(compressed);
         EXPECT_EQ(decompressed, data);
     }
+
+    TEST(MiscCompressionTest, decompressWithDictionaryIsInverseToCompressWithDictionary)
+    {
+        std::vector<std::byte> data(1024);
+        for (std::size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<std::byte>(i * 7919 % 251);
+        const std::vector<std::byte> dictionary = makeCompressionDictionary({data});
+        const std::vector<std::byte> compressed = compress(data, dictionary);
+        EXPECT_LT(compressed.size(), compress(data).size());
+        const std::vector<std::byte> decompressed = decompress(compressed, dictionary);
+        EXPECT_EQ(decompressed, data);
+    }
+
+    TEST(MiscCompressionTest, makeCompressionDictionaryShouldLimitSize)
+    {
+        const std::vector<std::vector<std::byte>> samples(100, std::vector<std::byte>(1024));
+        EXPECT_EQ(makeCompressionDictionary(samples).size(), 64 * 1024);
+    }
+
+    TEST(MiscCompressionTest, makeCompressionDictionaryShouldSkipTooLargeSamples)
+    {
+        const std::vector<std::vector<std::byte>> samples {
+            std::vector<std::byte>(128 * 1024),
+            std::vector<std::byte>(1024),
+            std::vector<std::byte>(64 * 1024),
+            std::vector<std::byte>(2048),
+        };
+        EXPECT_EQ(makeCompressionDictionary(samples).size(), 3 * 1024);
+    }
 }
@@ -0,0 +1,94 @@
+#include <components/misc/spatialgrid.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <limits>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace Misc;
+
+    struct MiscSpatialGridTest : Test
+    {
+        SpatialGrid<int> mGrid {100};
+
+        std::vector<int> getInRange(const osg::Vec3f& position, float radius) const
+        {
+            std::vector<int> result;
+            mGrid.forEachInRange(position, radius, [&] (int value) { result.push_back(value); });
+            return result;
+        }
+    };
+
+    TEST_F(MiscSpatialGridTest, emptyGridShouldFindNothing)
+    {
+        mGrid.build();
+        EXPECT_THAT(getInRange(osg::Vec3f(0, 0, 0), 1000), IsEmpty());
+    }
+
+    TEST_F(MiscSpatialGridTest, shouldFindValuesWithinRadius)
+    {
+        mGrid.add(osg::Vec3f(0, 0, 0), 1);
+        mGrid.add(osg::Vec3f(50, 0, 0), 2);
+        mGrid.add(osg::Vec3f(150, 0, 0), 3);
+        mGrid.add(osg::Vec3f(-99, 0, 0), 4);
+        mGrid.add(osg::Vec3f(0, 1000, 0), 5);
+        mGrid.build();
+        EXPECT_THAT(getInRange(osg::Vec3f(0, 0, 0), 100), UnorderedElementsAre(1, 2, 4));
+    }
+
+    TEST_F(MiscSpatialGridTest, shouldIncludeValuesOnRadius)
+    {
+        mGrid.add(osg::Vec3f(100, 0, 0), 1);
+        mGrid.build();
+        EXPECT_THAT(getInRange(osg::Vec3f(0, 0, 0), 100), ElementsAre(1));
+    }
+
+    TEST_F(MiscSpatialGridTest, shouldUseDistanceAlongZ)
+    {
+        mGrid.add(osg::Vec3f(0, 0, 60), 1);
+        mGrid.add(osg::Vec3f(0, 0, 600), 2);
+        mGrid.build();
+        EXPECT_THAT(getInRange(osg::Vec3f(0, 0, 0), 100), ElementsAre(1));
+    }
+
+    TEST_F(MiscSpatialGridTest, shouldHandleNegativeCoordinates)
+    {
+        mGrid.add(osg::Vec3f(-1050, -2050, 0), 1);
+        mGrid.add(osg::Vec3f(-950, -2050, 0), 2);
+        mGrid.add(osg::Vec3f(1050, 2050, 0), 3);
+        mGrid.build();
+        EXPECT_THAT(getInRange(osg::Vec3f(-1000, -2000, 0), 80), UnorderedElementsAre(1, 2));
+    }
+
+    TEST_F(MiscSpatialGridTest, queryCoveringManyCellsShouldFindAllValuesWithinRadius)
+    {
+        for (int i = 0; i < 10; ++i)
+            mGrid.add(osg::Vec3f(i * 1000.f, 0, 0), i);
+        mGrid.build();
+        EXPECT_THAT(getInRange(osg::Vec3f(0, 0, 0), 5000), UnorderedElementsAre(0, 1, 2, 3, 4, 5));
+        EXPECT_THAT(getInRange(osg::Vec3f(0, 0, 0), std::numeric_limits<float>::max()), SizeIs(10));
+    }
+
+    TEST_F(MiscSpatialGridTest, clearShouldRemoveAllValues)
+    {
+        mGrid.add(osg::Vec3f(0, 0, 0), 1);
+        mGrid.build();
+        mGrid.clear();
+        mGrid.build();
+        EXPECT_THAT(getInRange(osg::Vec3f(0, 0, 0), 100), IsEmpty());
+    }
+
+    TEST_F(MiscSpatialGridTest, anyInRangeShouldCheckDistance)
+    {
+        mGrid.add(osg::Vec3f(0, 0, 0), 1);
+        mGrid.add(osg::Vec3f(300, 0, 0), 2);
+        mGrid.build();
+        EXPECT_TRUE(mGrid.anyInRange(osg::Vec3f(250, 0, 0), 60));
+        EXPECT_FALSE(mGrid.anyInRange(osg::Vec3f(150, 0, 0), 100));
+        EXPECT_FALSE(mGrid.anyInRange(osg::Vec3f(0, 0, 500), 100));
+    }
+}
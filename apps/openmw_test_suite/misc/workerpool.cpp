@@ -0,0 +1,64 @@
+#include <components/misc/workerpool.hpp>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace Misc;
+
+    std::vector<int> countCalls(WorkerPool& pool, std::size_t count)
+    {
+        std::vector<std::atomic_int> calls(count);
+        pool.parallelFor(count, [&] (std::size_t i) { ++calls[i]; });
+        return std::vector<int>(calls.begin(), calls.end());
+    }
+
+    TEST(MiscWorkerPoolTest, parallelForShouldCallFunctionOnceForEachIndex)
+    {
+        WorkerPool pool(4);
+        EXPECT_EQ(pool.getThreadsCount(), 4u);
+        EXPECT_THAT(countCalls(pool, 100), Each(1));
+    }
+
+    TEST(MiscWorkerPoolTest, parallelForShouldBeReusable)
+    {
+        WorkerPool pool(3);
+        for (std::size_t i = 0; i < 10; ++i)
+            EXPECT_THAT(countCalls(pool, i * 7), Each(1));
+    }
+
+    TEST(MiscWorkerPoolTest, singleThreadPoolShouldUseCallingThread)
+    {
+        WorkerPool pool(1);
+        EXPECT_EQ(pool.getThreadsCount(), 1u);
+        const std::thread::id callingThread = std::this_thread::get_id();
+        std::vector<std::thread::id> threads;
+        pool.parallelFor(3, [&] (std::size_t) { threads.push_back(std::this_thread::get_id()); });
+        EXPECT_THAT(threads, ElementsAre(callingThread, callingThread, callingThread));
+    }
+
+    TEST(MiscWorkerPoolTest, parallelForShouldRethrowExceptionAfterAllCallsAreFinished)
+    {
+        WorkerPool pool(4);
+        std::atomic_int running {0};
+        EXPECT_THROW(pool.parallelFor(100, [&] (std::size_t i)
+        {
+            ++running;
+            if (i == 10)
+            {
+                --running;
+                throw std::runtime_error("error");
+            }
+            --running;
+        }), std::runtime_error);
+        EXPECT_EQ(running, 0);
+        EXPECT_THAT(countCalls(pool, 10), Each(1));
+    }
+}
@@ -0,0 +1,156 @@
+#include "apps/openmw/mwphysics/collisionsnapshot.hpp"
+
+#include <BulletCollision/BroadphaseCollision/btBroadphaseInterface.h>
+#include <BulletCollision/BroadphaseCollision/btDbvtBroadphase.h>
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcher.h>
+#include <BulletCollision/CollisionDispatch/btCollisionObject.h>
+#include <BulletCollision/CollisionDispatch/btDefaultCollisionConfiguration.h>
+#include <BulletCollision/CollisionShapes/btBoxShape.h>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace MWPhysics;
+
+    struct CollectObjects final : btBroadphaseAabbCallback
+    {
+        std::vector<const btCollisionObject*> mObjects;
+
+        bool process(const btBroadphaseProxy* proxy) override
+        {
+            mObjects.push_back(static_cast<const btCollisionObject*>(proxy->m_clientObject));
+            return true;
+        }
+    };
+
+    struct MWPhysicsCollisionSnapshotTest : Test
+    {
+        btBoxShape mShape {btVector3(1, 1, 1)};
+        btCollisionObject mObject;
+        btDefaultCollisionConfiguration mConfiguration;
+        btCollisionDispatcher mDispatcher {&mConfiguration};
+        btDbvtBroadphase mBroadphase;
+        btCollisionWorld mWorld {&mDispatcher, &mBroadphase, &mConfiguration};
+
+        MWPhysicsCollisionSnapshotTest()
+        {
+            mObject.setCollisionShape(&mShape);
+            mObject.getWorldTransform().setIdentity();
+            mObject.getWorldTransform().setOrigin(btVector3(10, 0, 0));
+        }
+
+        btCollisionWorld::ClosestRayResultCallback rayTest(const CollisionSnapshot& snapshot,
+            const btVector3& from, const btVector3& to) const
+        {
+            btCollisionWorld::ClosestRayResultCallback callback(from, to);
+            snapshot.rayTest(from, to, callback);
+            return callback;
+        }
+    };
+
+    TEST_F(MWPhysicsCollisionSnapshotTest, snapshot_of_empty_world_should_find_nothing)
+    {
+        const CollisionSnapshot snapshot(mWorld);
+        EXPECT_EQ(snapshot.size(), 0u);
+        EXPECT_FALSE(rayTest(snapshot, btVector3(0, 0, 0), btVector3(20, 0, 0)).hasHit());
+        CollectObjects callback;
+        snapshot.aabbTest(btVector3(-100, -100, -100), btVector3(100, 100, 100), callback);
+        EXPECT_THAT(callback.mObjects, IsEmpty());
+    }
+
+    TEST_F(MWPhysicsCollisionSnapshotTest, ray_test_should_hit_object)
+    {
+        mWorld.addCollisionObject(&mObject);
+        const CollisionSnapshot snapshot(mWorld);
+        EXPECT_EQ(snapshot.size(), 1u);
+        const auto callback = rayTest(snapshot, btVector3(0, 0, 0), btVector3(20, 0, 0));
+        ASSERT_TRUE(callback.hasHit());
+        EXPECT_EQ(callback.m_collisionObject, &mObject);
+        EXPECT_NEAR(callback.m_hitPointWorld.x(), 9, 1e-3);
+    }
+
+    TEST_F(MWPhysicsCollisionSnapshotTest, ray_test_should_skip_filtered_object)
+    {
+        mWorld.addCollisionObject(&mObject, btBroadphaseProxy::StaticFilter, btBroadphaseProxy::AllFilter);
+        const CollisionSnapshot snapshot(mWorld);
+        btCollisionWorld::ClosestRayResultCallback callback(btVector3(0, 0, 0), btVector3(20, 0, 0));
+        callback.m_collisionFilterMask = btBroadphaseProxy::DefaultFilter;
+        snapshot.rayTest(btVector3(0, 0, 0), btVector3(20, 0, 0), callback);
+        EXPECT_FALSE(callback.hasHit());
+    }
+
+    TEST_F(MWPhysicsCollisionSnapshotTest, aabb_test_should_find_only_intersecting_objects)
+    {
+        mWorld.addCollisionObject(&mObject);
+        const CollisionSnapshot snapshot(mWorld);
+        CollectObjects intersecting;
+        snapshot.aabbTest(btVector3(8, -2, -2), btVector3(12, 2, 2), intersecting);
+        EXPECT_THAT(intersecting.mObjects, ElementsAre(&mObject));
+        CollectObjects other;
+        snapshot.aabbTest(btVector3(-12, -2, -2), btVector3(-8, 2, 2), other);
+        EXPECT_THAT(other.mObjects, IsEmpty());
+    }
+
+    TEST_F(MWPhysicsCollisionSnapshotTest, snapshot_should_keep_state_from_when_it_was_built)
+    {
+        mWorld.addCollisionObject(&mObject);
+        const CollisionSnapshot snapshot(mWorld);
+        mObject.getWorldTransform().setOrigin(btVector3(100, 0, 0));
+        mWorld.updateAabbs();
+        EXPECT_TRUE(rayTest(snapshot, btVector3(0, 0, 0), btVector3(20, 0, 0)).hasHit());
+        EXPECT_FALSE(rayTest(snapshot, btVector3(90, 0, 0), btVector3(110, 0, 0)).hasHit());
+    }
+
+    struct MWPhysicsCollisionSnapshotHolderTest : MWPhysicsCollisionSnapshotTest
+    {
+        CollisionSnapshotHolder mHolder;
+
+        bool hasSnapshot() const
+        {
+            return mHolder.query([] (const CollisionSnapshot&) {});
+        }
+    };
+
+    TEST_F(MWPhysicsCollisionSnapshotHolderTest, query_should_return_false_without_snapshot)
+    {
+        EXPECT_FALSE(hasSnapshot());
+    }
+
+    TEST_F(MWPhysicsCollisionSnapshotHolderTest, publish_should_make_snapshot_available_for_queries)
+    {
+        mWorld.addCollisionObject(&mObject);
+        EXPECT_TRUE(mHolder.publish(std::make_unique<const CollisionSnapshot>(mWorld), mHolder.getGeneration()));
+        std::size_t size = 0;
+        EXPECT_TRUE(mHolder.query([&] (const CollisionSnapshot& snapshot) { size = snapshot.size(); }));
+        EXPECT_EQ(size, 1u);
+    }
+
+    TEST_F(MWPhysicsCollisionSnapshotHolderTest, invalidate_should_drop_snapshot)
+    {
+        EXPECT_TRUE(mHolder.publish(std::make_unique<const CollisionSnapshot>(mWorld), mHolder.getGeneration()));
+        mHolder.invalidate();
+        EXPECT_FALSE(hasSnapshot());
+    }
+
+    TEST_F(MWPhysicsCollisionSnapshotHolderTest, publish_should_reject_snapshot_built_before_invalidation)
+    {
+        const std::uint64_t generation = mHolder.getGeneration();
+        auto snapshot = std::make_unique<const CollisionSnapshot>(mWorld);
+        mHolder.invalidate();
+        EXPECT_FALSE(mHolder.publish(std::move(snapshot), generation));
+        EXPECT_FALSE(hasSnapshot());
+    }
+
+    TEST_F(MWPhysicsCollisionSnapshotHolderTest, publish_should_accept_snapshot_built_after_invalidation)
+    {
+        mHolder.invalidate();
+        EXPECT_TRUE(mHolder.publish(std::make_unique<const CollisionSnapshot>(mWorld), mHolder.getGeneration()));
+        EXPECT_TRUE(hasSnapshot());
+    }
+}
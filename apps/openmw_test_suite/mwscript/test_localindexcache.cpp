@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include <components/compiler/locals.hpp>
+
+#include "apps/openmw/mwscript/localindexcache.hpp"
+
+namespace
+{
+    using namespace testing;
+    using namespace MWScript;
+
+    struct MWScriptLocalIndexCacheTest : Test
+    {
+        LocalIndexCache mCache;
+        Compiler::Locals mLocals;
+        Interpreter::MemberSlot mSlot;
+        int mGetLocalsCount = 0;
+
+        MWScriptLocalIndexCacheTest()
+        {
+            mLocals.declare('s', "a");
+            mLocals.declare('s', "b");
+            mLocals.declare('f', "c");
+        }
+
+        auto getLocals()
+        {
+            return [this] () -> const Compiler::Locals&
+            {
+                ++mGetLocalsCount;
+                return mLocals;
+            };
+        }
+    };
+
+    TEST_F(MWScriptLocalIndexCacheTest, get_should_return_index_of_variable_with_given_type)
+    {
+        EXPECT_EQ(mCache.get("script", "b", 's', nullptr, getLocals()), 1);
+        EXPECT_EQ(mCache.get("script", "c", 'f', nullptr, getLocals()), 0);
+    }
+
+    TEST_F(MWScriptLocalIndexCacheTest, get_should_ignore_case_of_variable_name)
+    {
+        EXPECT_EQ(mCache.get("script", "B", 's', nullptr, getLocals()), 1);
+    }
+
+    TEST_F(MWScriptLocalIndexCacheTest, get_should_return_minus_one_for_missing_variable)
+    {
+        EXPECT_EQ(mCache.get("script", "d", 's', nullptr, getLocals()), -1);
+        EXPECT_EQ(mCache.get("script", "c", 's', nullptr, getLocals()), -1);
+    }
+
+    TEST_F(MWScriptLocalIndexCacheTest, get_should_throw_for_unknown_type)
+    {
+        EXPECT_THROW(mCache.get("script", "a", 'x', nullptr, getLocals()), std::logic_error);
+    }
+
+    TEST_F(MWScriptLocalIndexCacheTest, get_without_slot_should_get_locals_on_each_call)
+    {
+        mCache.get("script", "b", 's', nullptr, getLocals());
+        mCache.get("script", "b", 's', nullptr, getLocals());
+        EXPECT_EQ(mGetLocalsCount, 2);
+    }
+
+    TEST_F(MWScriptLocalIndexCacheTest, get_with_resolved_slot_should_not_get_locals)
+    {
+        EXPECT_EQ(mCache.get("script", "b", 's', &mSlot, getLocals()), 1);
+        EXPECT_EQ(mCache.get("script", "b", 's', &mSlot, getLocals()), 1);
+        EXPECT_EQ(mGetLocalsCount, 1);
+    }
+
+    TEST_F(MWScriptLocalIndexCacheTest, get_with_slot_should_resolve_index_again_for_other_script)
+    {
+        EXPECT_EQ(mCache.get("script", "b", 's', &mSlot, getLocals()), 1);
+        mLocals.clear();
+        mLocals.declare('s', "b");
+        EXPECT_EQ(mCache.get("other_script", "b", 's', &mSlot, getLocals()), 0);
+        EXPECT_EQ(mGetLocalsCount, 2);
+    }
+
+    TEST_F(MWScriptLocalIndexCacheTest, get_with_slot_should_resolve_index_again_after_invalidate)
+    {
+        EXPECT_EQ(mCache.get("script", "b", 's', &mSlot, getLocals()), 1);
+        // Script that failed to compile has no locals
+        mLocals.clear();
+        mCache.invalidate();
+        EXPECT_EQ(mCache.get("script", "b", 's', &mSlot, getLocals()), -1);
+    }
+
+    TEST_F(MWScriptLocalIndexCacheTest, get_with_slot_should_use_revision_after_invalidate_by_get_locals)
+    {
+        const auto getChangedLocals = [&] () -> const Compiler::Locals&
+        {
+            // Getting locals of a script that was not loaded yet stores them and invalidates indices
+            mCache.invalidate();
+            return mLocals;
+        };
+        EXPECT_EQ(mCache.get("script", "b", 's', &mSlot, getChangedLocals), 1);
+        EXPECT_EQ(mCache.get("script", "b", 's', &mSlot, getLocals()), 1);
+        EXPECT_EQ(mGetLocalsCount, 0);
+    }
+}
@@ -1,6 +1,10 @@
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <sstream>
 
+#include <components/compiler/generator.hpp>
+#include <components/compiler/output.hpp>
+
 #include "test_utils.hpp"
 
 namespace
@@ -44,9 +48,24 @@ namespace
             mCompilerContext.setExtensions(&mExtensions);
         }
 
+        Interpreter::Program prepare(const CompiledScript& script)
+        {
+            return mInterpreter.prepare(script.mByteCode.data(), static_cast<int>(script.mByteCode.size()));
+        }
+
+        void run(const CompiledScript& script, const Interpreter::Program& program, TestInterpreterContext& context)
+        {
+            mInterpreter.run(script.mByteCode.data(), static_cast<int>(script.mByteCode.size()), program, context);
+        }
+
         void run(const CompiledScript& script, TestInterpreterContext& context)
         {
-            mInterpreter.run(&script.mByteCode[0], static_cast<int>(script.mByteCode.size()), context);
+            run(script, prepare(script), context);
+        }
+
+        void runWithoutProgram(const CompiledScript& script, TestInterpreterContext& context)
+        {
+            mInterpreter.run(script.mByteCode.data(), static_cast<int>(script.mByteCode.size()), context);
         }
 
         template<typename T, typename ...TArgs>
@@ -848,4 +867,68 @@ messagebox,"this is a %g",a
     {
         EXPECT_FALSE(!compile(sIssue6380));
     }
+
+    TEST_F(MWScriptTest, mwscript_test_program_should_give_same_result_as_code)
+    {
+        registerExtensions();
+        if(const auto script = compile(sScript3))
+        {
+            TestInterpreterContext context;
+            context.setLocalShort(0, 3);
+            run(*script, context);
+            TestInterpreterContext expected;
+            expected.setLocalShort(0, 3);
+            runWithoutProgram(*script, expected);
+            for (int i = 0; i < 5; ++i)
+                EXPECT_EQ(context.getLocalShort(i), expected.getLocalShort(i)) << i;
+        }
+        else
+        {
+            FAIL();
+        }
+    }
+
+    std::vector<Interpreter::Type_Code> makeMemberFetchCode()
+    {
+        Compiler::Locals locals;
+        Compiler::Output output(locals);
+        Compiler::Generator::fetchMember(output.getCode(), output.getLiterals(), 's', "variable", "object", false);
+        Compiler::Generator::fetchMember(output.getCode(), output.getLiterals(), 'f', "variable", "object", false);
+        std::vector<Interpreter::Type_Code> code;
+        output.getCode(code);
+        return code;
+    }
+
+    TEST_F(MWScriptTest, mwscript_test_program_should_keep_member_slot_for_each_call_site)
+    {
+        const CompiledScript script(makeMemberFetchCode(), Compiler::Locals());
+        const Interpreter::Program program = prepare(script);
+        TestInterpreterContext context;
+        run(script, program, context);
+        run(script, program, context);
+        const std::vector<Interpreter::MemberSlot*>& slots = context.getMemberSlots();
+        ASSERT_EQ(slots.size(), 4u);
+        EXPECT_NE(slots[0], nullptr);
+        EXPECT_NE(slots[1], nullptr);
+        EXPECT_NE(slots[0], slots[1]);
+        EXPECT_EQ(slots[2], slots[0]);
+        EXPECT_EQ(slots[3], slots[1]);
+    }
+
+    TEST_F(MWScriptTest, mwscript_test_code_should_not_pass_member_slot)
+    {
+        const CompiledScript script(makeMemberFetchCode(), Compiler::Locals());
+        TestInterpreterContext context;
+        runWithoutProgram(script, context);
+        EXPECT_THAT(context.getMemberSlots(), ::testing::ElementsAre(nullptr, nullptr));
+    }
+
+    TEST_F(MWScriptTest, mwscript_test_program_with_unknown_opcode_should_fail_on_execution)
+    {
+        const Interpreter::Type_Code unknown = (0x32u << 26) | 0x3ffffff;
+        const CompiledScript script({1, 0, 0, 0, unknown}, Compiler::Locals());
+        const Interpreter::Program program = prepare(script);
+        TestInterpreterContext context;
+        EXPECT_THROW(run(script, program, context), std::runtime_error);
+    }
 }
\ No newline at end of file
@@ -139,7 +139,11 @@ namespace
     {
         LocalVariables mLocals;
         std::map<std::string, GlobalVariables, std::less<>> mMembers;
+        // Slots passed for member variable accesses in order
+        mutable std::vector<Interpreter::MemberSlot*> mMemberSlots;
     public:
+        const std::vector<Interpreter::MemberSlot*>& getMemberSlots() const { return mMemberSlots; }
+
         std::string_view getTarget() const override { return {}; };
 
         int getLocalShort(int index) const override { return mLocals.getShort(index); };
@@ -200,35 +204,50 @@ namespace
 
         std::string_view getCurrentCellName() const override { return {}; };
 
-        int getMemberShort(std::string_view id, std::string_view name, bool global) const override
+        int getMemberShort(std::string_view id, std::string_view name, bool global, Interpreter::MemberSlot* slot) const override
         {
+            mMemberSlots.push_back(slot);
             auto it = mMembers.find(id);
             if(it != mMembers.end())
                 return it->second.getShort(name);
             return {};
         };
 
-        int getMemberLong(std::string_view id, std::string_view name, bool global) const override
+        int getMemberLong(std::string_view id, std::string_view name, bool global, Interpreter::MemberSlot* slot) const override
         {
+            mMemberSlots.push_back(slot);
             auto it = mMembers.find(id);
             if(it != mMembers.end())
                 return it->second.getLong(name);
             return {};
         };
 
-        float getMemberFloat(std::string_view id, std::string_view name, bool global) const override
+        float getMemberFloat(std::string_view id, std::string_view name, bool global, Interpreter::MemberSlot* slot) const override
         {
+            mMemberSlots.push_back(slot);
             auto it = mMembers.find(id);
             if(it != mMembers.end())
                 return it->second.getFloat(name);
             return {};
         };
 
-        void setMemberShort(std::string_view id, std::string_view name, int value, bool global) override { mMembers[std::string(id)].setShort(name, value); };
+        void setMemberShort(std::string_view id, std::string_view name, int value, bool global, Interpreter::MemberSlot* slot) override
+        {
+            mMemberSlots.push_back(slot);
+            mMembers[std::string(id)].setShort(name, value);
+        };
 
-        void setMemberLong(std::string_view id, std::string_view name, int value, bool global) override { mMembers[std::string(id)].setLong(name, value); };
+        void setMemberLong(std::string_view id, std::string_view name, int value, bool global, Interpreter::MemberSlot* slot) override
+        {
+            mMemberSlots.push_back(slot);
+            mMembers[std::string(id)].setLong(name, value);
+        };
 
-        void setMemberFloat(std::string_view id, std::string_view name, float value, bool global) override { mMembers[std::string(id)].setFloat(name, value); };
+        void setMemberFloat(std::string_view id, std::string_view name, float value, bool global, Interpreter::MemberSlot* slot) override
+        {
+            mMemberSlots.push_back(slot);
+            mMembers[std::string(id)].setFloat(name, value);
+        };
     };
 
     struct CompiledScript
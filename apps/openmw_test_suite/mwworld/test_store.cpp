@@ -307,3 +307,97 @@ TEST_F(StoreTest, overwrite_test)
 
     ASSERT_TRUE (overwrittenRec && overwrittenRec->mModel == "the_new_model");
 }
+
+/// Tests counting of references collected while loading cells.
+TEST_F(StoreTest, ref_count_test)
+{
+    ESM::Class cls;
+    cls.blank();
+    cls.mId = "class";
+
+    ESM::Cell cell;
+    cell.blank();
+    cell.mName = "cell";
+    cell.mData.mFlags = ESM::Cell::Interior;
+
+    const auto makeRef = [] (unsigned index, const std::string& refId)
+    {
+        ESM::CellRef ref;
+        ref.blank();
+        ref.mRefNum.mIndex = index;
+        ref.mRefNum.mContentFile = 0;
+        ref.mRefID = refId;
+        return ref;
+    };
+
+    ESM::ESMWriter writer;
+    auto stream = std::make_unique<std::stringstream>();
+    writer.setFormat(0);
+    writer.save(*stream);
+    writer.startRecord(ESM::Class::sRecordId);
+    cls.save(writer);
+    writer.endRecord(ESM::Class::sRecordId);
+    writer.startRecord(ESM::Cell::sRecordId);
+    cell.save(writer);
+    makeRef(1, "foo").save(writer);
+    makeRef(2, "Foo").save(writer);
+    makeRef(3, "bar").save(writer);
+    makeRef(3, "bar").save(writer, false, false, true);
+    writer.endRecord(ESM::Cell::sRecordId);
+
+    ESM::ESMReader reader;
+    ESM::Dialogue* dialogue = nullptr;
+    reader.open(std::move(stream), "filename");
+    mEsmStore.load(reader, &dummyListener, dialogue);
+    mEsmStore.setUp();
+    mEsmStore.validateRecords();
+
+    EXPECT_EQ(mEsmStore.getRefCount("foo"), 2);
+    EXPECT_EQ(mEsmStore.getRefCount("bar"), 0);
+}
+
+/// Tests loading of records read by stage.
+TEST_F(StoreTest, staged_load_test)
+{
+    ESM::Apparatus apparatus;
+    apparatus.blank();
+    apparatus.mId = "foobar";
+
+    ESM::Cell cell;
+    cell.blank();
+    cell.mName = "cell";
+    cell.mData.mFlags = ESM::Cell::Interior;
+
+    ESM::ESMWriter writer;
+    auto stream = std::make_unique<std::stringstream>();
+    writer.setFormat(0);
+    writer.save(*stream);
+    writer.startRecord(ESM::Apparatus::sRecordId);
+    apparatus.save(writer);
+    writer.endRecord(ESM::Apparatus::sRecordId);
+    writer.startRecord(ESM::Cell::sRecordId);
+    cell.save(writer);
+    writer.endRecord(ESM::Cell::sRecordId);
+
+    ESM::ESMReader reader;
+    ESM::Dialogue* dialogue = nullptr;
+
+    reader.open(std::move(stream), "filename");
+    MWWorld::ESMStore::StagedRecords staged = mEsmStore.stage(reader);
+    ASSERT_EQ(staged.size(), 2u);
+    EXPECT_NE(staged[0].mRecord, nullptr);
+    EXPECT_EQ(staged[1].mRecord, nullptr);
+    EXPECT_EQ(mEsmStore.get<ESM::Apparatus>().getSize(), 0u);
+
+    mEsmStore.load(reader, std::move(staged), &dummyListener, dialogue);
+    mEsmStore.setUp();
+
+    EXPECT_EQ(mEsmStore.get<ESM::Apparatus>().getSize(), 1u);
+    EXPECT_NE(mEsmStore.get<ESM::Cell>().search("cell"), nullptr);
+
+    reader.open(getEsmFile(apparatus, true), "filename");
+    mEsmStore.load(reader, mEsmStore.stage(reader), &dummyListener, dialogue);
+    mEsmStore.setUp();
+
+    EXPECT_EQ(mEsmStore.get<ESM::Apparatus>().getSize(), 0u);
+}
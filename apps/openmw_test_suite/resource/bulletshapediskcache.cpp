@@ -0,0 +1,143 @@
+#include <components/bullethelpers/processtrianglecallback.hpp>
+#include <components/resource/bulletshape.hpp>
+#include <components/resource/bulletshapediskcache.hpp>
+
+#include <BulletCollision/CollisionShapes/btBoxShape.h>
+#include <BulletCollision/CollisionShapes/btCompoundShape.h>
+#include <BulletCollision/CollisionShapes/btOptimizedBvh.h>
+#include <BulletCollision/CollisionShapes/btSphereShape.h>
+#include <BulletCollision/CollisionShapes/btTriangleMesh.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace Resource;
+
+    std::unique_ptr<TriangleMeshShape> makeTriangleMeshShape()
+    {
+        auto mesh = std::make_unique<btTriangleMesh>();
+        mesh->addTriangle(btVector3(0, 0, 0), btVector3(1, 0, 0), btVector3(0, 1, 0));
+        mesh->addTriangle(btVector3(1, 0, 0), btVector3(1, 1, 0), btVector3(0, 1, 1));
+        return std::make_unique<TriangleMeshShape>(mesh.release(), true);
+    }
+
+    std::vector<btVector3> getTriangles(const btBvhTriangleMeshShape& shape)
+    {
+        std::vector<btVector3> result;
+        auto callback = BulletHelpers::makeProcessTriangleCallback([&] (btVector3* triangle, int, int) {
+            for (std::size_t i = 0; i < 3; ++i)
+                result.push_back(triangle[i]);
+        });
+        btVector3 aabbMin;
+        btVector3 aabbMax;
+        shape.getAabb(btTransform::getIdentity(), aabbMin, aabbMax);
+        shape.processAllTriangles(&callback, aabbMin, aabbMax);
+        return result;
+    }
+
+    osg::ref_ptr<BulletShape> writeAndRead(const BulletShape& shape)
+    {
+        std::stringstream stream;
+        writeBulletShape(shape, stream);
+        return readBulletShape(stream);
+    }
+
+    TEST(ResourceBulletShapeSerializationTest, should_read_written_triangle_mesh_shape)
+    {
+        osg::ref_ptr<BulletShape> shape(new BulletShape);
+        shape->mFileHash = "hash";
+        shape->mCollisionBox.mExtents = osg::Vec3f(1, 2, 3);
+        shape->mCollisionBox.mCenter = osg::Vec3f(4, 5, 6);
+        shape->mCollisionType = BulletShape::CollisionType::Camera;
+        shape->mCollisionShape.reset(makeTriangleMeshShape().release());
+        const std::vector<btVector3> triangles = getTriangles(
+            static_cast<const btBvhTriangleMeshShape&>(*shape->mCollisionShape));
+
+        const osg::ref_ptr<BulletShape> result = writeAndRead(*shape);
+
+        EXPECT_EQ(result->mFileHash, "hash");
+        EXPECT_EQ(result->mCollisionBox.mExtents, osg::Vec3f(1, 2, 3));
+        EXPECT_EQ(result->mCollisionBox.mCenter, osg::Vec3f(4, 5, 6));
+        EXPECT_EQ(result->mCollisionType, static_cast<unsigned>(BulletShape::CollisionType::Camera));
+        EXPECT_EQ(result->mAvoidCollisionShape.get(), nullptr);
+        ASSERT_NE(result->mCollisionShape.get(), nullptr);
+        ASSERT_EQ(result->mCollisionShape->getShapeType(), TRIANGLE_MESH_SHAPE_PROXYTYPE);
+        const auto& resultShape = static_cast<const btBvhTriangleMeshShape&>(*result->mCollisionShape);
+        EXPECT_TRUE(resultShape.usesQuantizedAabbCompression());
+        EXPECT_EQ(getTriangles(resultShape), triangles);
+    }
+
+    TEST(ResourceBulletShapeSerializationTest, should_read_written_compound_shape)
+    {
+        osg::ref_ptr<BulletShape> shape(new BulletShape);
+        auto compound = std::make_unique<btCompoundShape>();
+        auto triangleMeshShape = makeTriangleMeshShape();
+        triangleMeshShape->setLocalScaling(btVector3(2, 2, 2));
+        const std::vector<btVector3> triangles = getTriangles(*triangleMeshShape);
+        const btTransform transform(btMatrix3x3::getIdentity(), btVector3(1, 2, 3));
+        compound->addChildShape(transform, triangleMeshShape.release());
+        compound->addChildShape(btTransform::getIdentity(), new btBoxShape(btVector3(1, 2, 3)));
+        shape->mCollisionShape.reset(compound.release());
+        shape->mAnimatedShapes.emplace(42, 0);
+
+        const osg::ref_ptr<BulletShape> result = writeAndRead(*shape);
+
+        EXPECT_THAT(result->mAnimatedShapes, ElementsAre(std::pair(42, 0)));
+        ASSERT_NE(result->mCollisionShape.get(), nullptr);
+        ASSERT_TRUE(result->mCollisionShape->isCompound());
+        const auto& resultCompound = static_cast<const btCompoundShape&>(*result->mCollisionShape);
+        ASSERT_EQ(resultCompound.getNumChildShapes(), 2);
+        EXPECT_EQ(resultCompound.getChildTransform(0).getOrigin(), btVector3(1, 2, 3));
+        ASSERT_EQ(resultCompound.getChildShape(0)->getShapeType(), TRIANGLE_MESH_SHAPE_PROXYTYPE);
+        const auto& resultMesh = static_cast<const btBvhTriangleMeshShape&>(*resultCompound.getChildShape(0));
+        EXPECT_EQ(resultMesh.getLocalScaling(), btVector3(2, 2, 2));
+        EXPECT_EQ(getTriangles(resultMesh), triangles);
+        ASSERT_EQ(resultCompound.getChildShape(1)->getShapeType(), BOX_SHAPE_PROXYTYPE);
+        const auto& resultBox = static_cast<const btBoxShape&>(*resultCompound.getChildShape(1));
+        EXPECT_LE((resultBox.getHalfExtentsWithMargin() - btVector3(1, 2, 3)).length(), 1e-5);
+    }
+
+    TEST(ResourceBulletShapeSerializationTest, write_should_throw_for_unsupported_shape)
+    {
+        osg::ref_ptr<BulletShape> shape(new BulletShape);
+        shape->mCollisionShape.reset(new btSphereShape(1));
+        std::stringstream stream;
+        EXPECT_THROW(writeBulletShape(*shape, stream), std::runtime_error);
+    }
+
+    TEST(ResourceBulletShapeSerializationTest, read_should_throw_for_invalid_data)
+    {
+        std::stringstream stream("invalid data");
+        EXPECT_THROW(readBulletShape(stream), std::runtime_error);
+    }
+
+    TEST(ResourceBulletShapeSerializationTest, read_should_throw_for_too_small_bvh)
+    {
+        osg::ref_ptr<BulletShape> shape(new BulletShape);
+        shape->mCollisionShape.reset(makeTriangleMeshShape().release());
+        std::stringstream stream;
+        writeBulletShape(*shape, stream);
+        const std::string data = stream.str();
+
+        // Triangle mesh shape ends with bvh size and data followed by the empty avoid collision shape
+        const std::size_t bvhSize = static_cast<btBvhTriangleMeshShape&>(*shape->mCollisionShape).getOptimizedBvh()
+            ->calculateSerializeBufferSize();
+        const std::size_t bvhSizeOffset = data.size() - 1 - bvhSize - sizeof(std::uint64_t);
+        const std::uint64_t invalidBvhSize = 8;
+        std::string invalidData = data.substr(0, bvhSizeOffset);
+        invalidData.append(reinterpret_cast<const char*>(&invalidBvhSize), sizeof(invalidBvhSize));
+        invalidData.append(data, bvhSizeOffset + sizeof(std::uint64_t), invalidBvhSize);
+        invalidData.push_back('\0');
+
+        std::stringstream invalidStream(invalidData);
+        EXPECT_THROW(readBulletShape(invalidStream), std::runtime_error);
+    }
+}
@@ -0,0 +1,143 @@
+#include <components/resource/diskcache.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../testing_util.hpp"
+
+namespace
+{
+    using namespace testing;
+    using namespace Resource;
+
+    using Value = std::shared_ptr<const std::string>;
+
+    Value readValue(std::istream& stream)
+    {
+        return std::make_shared<const std::string>(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+
+    bool writeValue(const std::string& value, std::ostream& stream)
+    {
+        stream << value;
+        return true;
+    }
+
+    struct ResourceDiskCacheTest : Test
+    {
+        const std::filesystem::path mPath = TestingOpenMW::temporaryFilePath("openmw_resource_disk_cache");
+        DiskCache mCache {mPath, "value"};
+        std::size_t mLoadCount = 0;
+
+        ResourceDiskCacheTest()
+        {
+            std::filesystem::remove_all(mPath);
+        }
+
+        ~ResourceDiskCacheTest()
+        {
+            std::filesystem::remove_all(mPath);
+        }
+
+        template <class Read = decltype(&readValue), class Write = decltype(&writeValue)>
+        Value getOrLoad(const std::string& name, const std::string& content, const std::string& suffix = ".value",
+            Read read = &readValue, Write write = &writeValue)
+        {
+            std::istringstream stream(content);
+            return mCache.getOrLoad(name, stream, suffix, read,
+                [&] { ++mLoadCount; return std::make_shared<const std::string>("loaded"); }, write);
+        }
+
+        std::vector<std::filesystem::path> getFiles() const
+        {
+            std::vector<std::filesystem::path> result;
+            if (std::filesystem::exists(mPath))
+                for (const auto& entry : std::filesystem::directory_iterator(mPath))
+                    result.push_back(entry.path().filename());
+            return result;
+        }
+    };
+
+    TEST_F(ResourceDiskCacheTest, get_or_load_should_read_stored_value_for_same_content)
+    {
+        getOrLoad("a", "content");
+        const Value result = getOrLoad("b", "content");
+        ASSERT_NE(result.get(), nullptr);
+        EXPECT_EQ(*result, "loaded");
+        EXPECT_EQ(mLoadCount, 1u);
+        EXPECT_EQ(mCache.getStats().mHits, 1u);
+        EXPECT_EQ(mCache.getStats().mMisses, 1u);
+        const std::vector<std::filesystem::path> files = getFiles();
+        ASSERT_EQ(files.size(), 1u);
+        EXPECT_EQ(files.front().extension(), ".value");
+        EXPECT_EQ(files.front().stem().string().size(), 32u);
+    }
+
+    TEST_F(ResourceDiskCacheTest, get_or_load_should_load_again_for_changed_content)
+    {
+        getOrLoad("a", "content1");
+        getOrLoad("a", "content2");
+        EXPECT_EQ(mLoadCount, 2u);
+        EXPECT_EQ(mCache.getStats().mHits, 0u);
+        EXPECT_EQ(getFiles().size(), 2u);
+    }
+
+    TEST_F(ResourceDiskCacheTest, get_or_load_should_load_again_for_other_suffix)
+    {
+        getOrLoad("a", "content", ".value1");
+        getOrLoad("a", "content", ".value2");
+        EXPECT_EQ(mLoadCount, 2u);
+        EXPECT_EQ(mCache.getStats().mHits, 0u);
+    }
+
+    TEST_F(ResourceDiskCacheTest, get_or_load_should_load_again_when_read_has_failed)
+    {
+        getOrLoad("a", "content");
+        const auto read = [] (std::istream&) -> Value { throw std::runtime_error("error"); };
+        const Value result = getOrLoad("a", "content", ".value", read);
+        ASSERT_NE(result.get(), nullptr);
+        EXPECT_EQ(*result, "loaded");
+        EXPECT_EQ(mLoadCount, 2u);
+        EXPECT_EQ(mCache.getStats().mHits, 0u);
+    }
+
+    TEST_F(ResourceDiskCacheTest, get_or_load_should_load_again_when_read_returns_nullptr)
+    {
+        getOrLoad("a", "content");
+        const auto read = [] (std::istream&) { return Value(); };
+        getOrLoad("a", "content", ".value", read);
+        EXPECT_EQ(mLoadCount, 2u);
+    }
+
+    TEST_F(ResourceDiskCacheTest, get_or_load_should_not_store_value_when_write_returns_false)
+    {
+        const auto write = [] (const std::string& value, std::ostream& stream) { stream << value; return false; };
+        getOrLoad("a", "content", ".value", &readValue, write);
+        EXPECT_THAT(getFiles(), IsEmpty());
+        getOrLoad("a", "content");
+        EXPECT_EQ(mLoadCount, 2u);
+    }
+
+    TEST_F(ResourceDiskCacheTest, get_or_load_should_not_leave_files_when_write_has_failed)
+    {
+        const auto write = [] (const std::string& value, std::ostream& stream) -> bool
+        {
+            stream << value;
+            throw std::runtime_error("error");
+        };
+        const Value result = getOrLoad("a", "content", ".value", &readValue, write);
+        ASSERT_NE(result.get(), nullptr);
+        EXPECT_EQ(*result, "loaded");
+        EXPECT_THAT(getFiles(), IsEmpty());
+    }
+}
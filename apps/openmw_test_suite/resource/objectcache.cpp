@@ -0,0 +1,150 @@
+#include <components/resource/objectcache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+    using namespace testing;
+    using namespace Resource;
+
+    struct ResourceObjectCacheTest : Test
+    {
+        osg::ref_ptr<GenericObjectCache<int>> mCache = new GenericObjectCache<int>;
+        const int mKey = 42;
+    };
+
+    TEST_F(ResourceObjectCacheTest, get_or_load_should_return_cached_object_without_loading)
+    {
+        osg::ref_ptr<osg::Object> object = new osg::Node;
+        mCache->addEntryToObjectCache(mKey, object);
+        int loads = 0;
+        const osg::ref_ptr<osg::Object> result = mCache->getOrLoad(mKey, [&] { ++loads; return osg::ref_ptr<osg::Object>(); });
+        EXPECT_EQ(result, object);
+        EXPECT_EQ(loads, 0);
+    }
+
+    TEST_F(ResourceObjectCacheTest, get_or_load_should_return_loaded_object)
+    {
+        osg::ref_ptr<osg::Object> object = new osg::Node;
+        const osg::ref_ptr<osg::Object> result = mCache->getOrLoad(mKey, [&]
+        {
+            mCache->addEntryToObjectCache(mKey, object);
+            return object;
+        });
+        EXPECT_EQ(result, object);
+        EXPECT_EQ(mCache->getRefFromObjectCache(mKey), object);
+    }
+
+    TEST_F(ResourceObjectCacheTest, get_or_load_should_rethrow_load_exception)
+    {
+        EXPECT_THROW(mCache->getOrLoad(mKey, [] () -> osg::ref_ptr<osg::Object> { throw std::runtime_error("error"); }),
+            std::runtime_error);
+        osg::ref_ptr<osg::Object> object = new osg::Node;
+        EXPECT_EQ(mCache->getOrLoad(mKey, [&] { return object; }), object);
+    }
+
+    TEST_F(ResourceObjectCacheTest, get_or_load_should_allow_recursive_load_of_the_same_key)
+    {
+        osg::ref_ptr<osg::Object> object = new osg::Node;
+        const osg::ref_ptr<osg::Object> result = mCache->getOrLoad(mKey, [&]
+        {
+            return mCache->getOrLoad(mKey, [&] { return object; });
+        });
+        EXPECT_EQ(result, object);
+    }
+
+    TEST_F(ResourceObjectCacheTest, concurrent_get_or_load_should_wait_for_single_load)
+    {
+        osg::ref_ptr<osg::Object> object = new osg::Node;
+        std::promise<void> started;
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+
+        std::future<osg::ref_ptr<osg::Object>> first = std::async(std::launch::async, [&]
+        {
+            return mCache->getOrLoad(mKey, [&]
+            {
+                started.set_value();
+                released.wait();
+                mCache->addEntryToObjectCache(mKey, object);
+                return object;
+            });
+        });
+        started.get_future().wait();
+
+        int secondLoads = 0;
+        std::future<osg::ref_ptr<osg::Object>> second = std::async(std::launch::async, [&]
+        {
+            return mCache->getOrLoad(mKey, [&] { ++secondLoads; return osg::ref_ptr<osg::Object>(); });
+        });
+        while (mCache->getSharedLoadsCount() == 0)
+            std::this_thread::yield();
+        release.set_value();
+
+        EXPECT_EQ(first.get(), object);
+        EXPECT_EQ(second.get(), object);
+        EXPECT_EQ(secondLoads, 0);
+        EXPECT_EQ(mCache->getSharedLoadsCount(), 1u);
+    }
+
+    TEST_F(ResourceObjectCacheTest, remove_expired_should_remove_least_recently_used_objects_over_max_size)
+    {
+        mCache->setMaxCacheMemorySize(2);
+        mCache->addEntryToObjectCache(1, new osg::Node, 0.0, 1);
+        mCache->addEntryToObjectCache(2, new osg::Node, 0.0, 1);
+        mCache->addEntryToObjectCache(3, new osg::Node, 0.0, 1);
+        mCache->updateTimeStampOfObjectsInCacheWithExternalReferences(1.0);
+        mCache->checkInObjectCache(2, 2.0);
+        mCache->checkInObjectCache(1, 3.0);
+        mCache->updateTimeStampOfObjectsInCacheWithExternalReferences(4.0);
+        mCache->removeExpiredObjectsInCache(0.0);
+        EXPECT_EQ(mCache->getCacheMemorySize(), 2u);
+        EXPECT_NE(mCache->getRefFromObjectCache(1).get(), nullptr);
+        EXPECT_NE(mCache->getRefFromObjectCache(2).get(), nullptr);
+        EXPECT_EQ(mCache->getRefFromObjectCache(3).get(), nullptr);
+    }
+
+    TEST_F(ResourceObjectCacheTest, remove_expired_should_keep_referenced_objects_over_max_size)
+    {
+        mCache->setMaxCacheMemorySize(1);
+        osg::ref_ptr<osg::Object> first = new osg::Node;
+        osg::ref_ptr<osg::Object> second = new osg::Node;
+        mCache->addEntryToObjectCache(1, first, 0.0, 1);
+        mCache->addEntryToObjectCache(2, second, 0.0, 1);
+        mCache->updateTimeStampOfObjectsInCacheWithExternalReferences(1.0);
+        mCache->removeExpiredObjectsInCache(0.0);
+        EXPECT_EQ(mCache->getCacheMemorySize(), 2u);
+        EXPECT_EQ(mCache->getCacheSize(), 2u);
+    }
+
+    TEST_F(ResourceObjectCacheTest, remove_expired_should_keep_objects_with_uninitialized_time_stamp_over_max_size)
+    {
+        mCache->setMaxCacheMemorySize(1);
+        mCache->addEntryToObjectCache(1, new osg::Node, 0.0, 1);
+        mCache->addEntryToObjectCache(2, new osg::Node, 0.0, 1);
+        mCache->removeExpiredObjectsInCache(-1.0);
+        EXPECT_EQ(mCache->getCacheSize(), 2u);
+    }
+
+    TEST_F(ResourceObjectCacheTest, remove_expired_should_not_limit_size_by_default)
+    {
+        mCache->addEntryToObjectCache(1, new osg::Node, 0.0, 1);
+        mCache->addEntryToObjectCache(2, new osg::Node, 0.0, 1);
+        mCache->updateTimeStampOfObjectsInCacheWithExternalReferences(1.0);
+        mCache->removeExpiredObjectsInCache(0.0);
+        EXPECT_EQ(mCache->getCacheSize(), 2u);
+    }
+
+    TEST_F(ResourceObjectCacheTest, remove_from_object_cache_should_update_memory_size)
+    {
+        mCache->addEntryToObjectCache(1, new osg::Node, 0.0, 3);
+        mCache->addEntryToObjectCache(1, new osg::Node, 0.0, 2);
+        EXPECT_EQ(mCache->getCacheMemorySize(), 2u);
+        mCache->removeFromObjectCache(1);
+        EXPECT_EQ(mCache->getCacheMemorySize(), 0u);
+    }
+}
@@ -0,0 +1,120 @@
+#include <components/nifosg/matrixtransform.hpp>
+#include <components/resource/templatediskcache.hpp>
+
+#include <osg/Geometry>
+#include <osg/Group>
+#include <osg/Texture2D>
+
+#include <osgDB/Registry>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <memory>
+#include <sstream>
+
+#include "../testing_util.hpp"
+
+namespace
+{
+    using namespace testing;
+    using namespace Resource;
+
+    struct ResourceTemplateDiskCacheTest : Test
+    {
+        const std::filesystem::path mPath = TestingOpenMW::temporaryFilePath("openmw_template_disk_cache");
+        TestingOpenMW::VFSTestFile mTexture {"texture"};
+        const std::unique_ptr<VFS::Manager> mVFS = TestingOpenMW::createTestVFS({{"textures/a.dds", &mTexture}});
+
+        ResourceTemplateDiskCacheTest()
+        {
+            std::filesystem::remove_all(mPath);
+        }
+
+        ~ResourceTemplateDiskCacheTest()
+        {
+            std::filesystem::remove_all(mPath);
+        }
+    };
+
+    osg::ref_ptr<osg::Group> makeStaticScene()
+    {
+        osg::ref_ptr<osg::Group> root(new osg::Group);
+        Nif::Transformation trafo = Nif::Transformation::getIdentity();
+        trafo.scale = 2;
+        trafo.pos = osg::Vec3f(1, 2, 3);
+        osg::ref_ptr<NifOsg::MatrixTransform> transform(new NifOsg::MatrixTransform(trafo));
+        transform->addChild(new osg::Geometry);
+        root->addChild(transform);
+        return root;
+    }
+
+    TEST_F(ResourceTemplateDiskCacheTest, static_scene_should_be_serializable)
+    {
+        EXPECT_TRUE(isSerializableTemplate(*makeStaticScene()));
+    }
+
+    TEST_F(ResourceTemplateDiskCacheTest, scene_with_callback_should_not_be_serializable)
+    {
+        const osg::ref_ptr<osg::Group> scene = makeStaticScene();
+        scene->getChild(0)->setUpdateCallback(new osg::NodeCallback);
+        EXPECT_FALSE(isSerializableTemplate(*scene));
+    }
+
+    TEST_F(ResourceTemplateDiskCacheTest, scene_with_embedded_image_should_not_be_serializable)
+    {
+        const osg::ref_ptr<osg::Group> scene = makeStaticScene();
+        scene->getOrCreateStateSet()->setTextureAttribute(0, new osg::Texture2D(new osg::Image));
+        EXPECT_FALSE(isSerializableTemplate(*scene));
+    }
+
+    TEST_F(ResourceTemplateDiskCacheTest, get_or_load_should_read_stored_scene)
+    {
+        if (osgDB::Registry::instance()->getReaderWriterForExtension("osgb") == nullptr)
+            GTEST_SKIP() << "osgb plugin is not available";
+
+        TemplateDiskCache cache(mPath, *mVFS, nullptr);
+        std::size_t loadCount = 0;
+        const auto load = [&] { ++loadCount; return osg::ref_ptr<osg::Node>(makeStaticScene()); };
+
+        std::istringstream content1("content");
+        cache.getOrLoad("meshes/a.nif", content1, load);
+        std::istringstream content2("content");
+        const osg::ref_ptr<osg::Node> result = cache.getOrLoad("meshes/b.nif", content2, load);
+
+        EXPECT_EQ(loadCount, 1u);
+        EXPECT_EQ(cache.getStats().mHits, 1u);
+        EXPECT_EQ(cache.getStats().mMisses, 1u);
+        ASSERT_NE(result->asGroup(), nullptr);
+        ASSERT_EQ(result->asGroup()->getNumChildren(), 1u);
+        const auto transform = dynamic_cast<const NifOsg::MatrixTransform*>(result->asGroup()->getChild(0));
+        ASSERT_NE(transform, nullptr);
+        EXPECT_EQ(transform->mScale, 2.f);
+        EXPECT_EQ(transform->getMatrix().getTrans(), osg::Vec3d(1, 2, 3));
+    }
+
+    TEST_F(ResourceTemplateDiskCacheTest, get_or_load_should_load_again_for_changed_textures)
+    {
+        if (osgDB::Registry::instance()->getReaderWriterForExtension("osgb") == nullptr)
+            GTEST_SKIP() << "osgb plugin is not available";
+
+        std::size_t loadCount = 0;
+        const auto load = [&] { ++loadCount; return osg::ref_ptr<osg::Node>(makeStaticScene()); };
+
+        TemplateDiskCache cache1(mPath, *mVFS, nullptr);
+        std::istringstream content1("content");
+        cache1.getOrLoad("meshes/a.nif", content1, load);
+
+        // Texture names in NIF files may resolve to other files now
+        const std::unique_ptr<VFS::Manager> otherVFS = TestingOpenMW::createTestVFS({
+            {"textures/a.dds", &mTexture},
+            {"textures/a.tga", &mTexture},
+        });
+        TemplateDiskCache cache2(mPath, *otherVFS, nullptr);
+        std::istringstream content2("content");
+        cache2.getOrLoad("meshes/a.nif", content2, load);
+
+        EXPECT_EQ(loadCount, 2u);
+        EXPECT_EQ(cache2.getStats().mHits, 0u);
+    }
+}
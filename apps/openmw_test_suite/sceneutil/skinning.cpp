@@ -0,0 +1,62 @@
+#include <components/sceneutil/skinning.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace SceneUtil;
+
+    // Rotation by 90 degrees around z, scale by 2 and translation by (10, 20, 30) in osg::Matrixf layout
+    constexpr std::array<float, 16> matrix {
+        0, 2, 0, 0,
+        -2, 0, 0, 0,
+        0, 0, 2, 0,
+        10, 20, 30, 1,
+    };
+
+    struct SceneUtilSkinVerticesTest : Test
+    {
+        const std::vector<float> mPositions {1, 2, 3, 4, 5, 6, 7, 8, 9};
+        const std::vector<float> mNormals {1, 0, 0, 0, 1, 0, 0, 0, 1};
+        const std::vector<float> mTangents {1, 0, 0, 1, 0, 1, 0, -1, 0, 0, 1, 1};
+        std::vector<float> mSkinnedPositions = std::vector<float>(9, -1);
+        std::vector<float> mSkinnedNormals = std::vector<float>(9, -1);
+        std::vector<float> mSkinnedTangents = std::vector<float>(12, -1);
+        SkinningArrays mArrays;
+
+        SceneUtilSkinVerticesTest()
+        {
+            mArrays.mPositionSrc = mPositions.data();
+            mArrays.mPositionDst = mSkinnedPositions.data();
+        }
+    };
+
+    TEST_F(SceneUtilSkinVerticesTest, shouldTransformPositions)
+    {
+        const std::vector<unsigned short> indices {0, 2};
+        skinVertices(matrix.data(), indices.data(), indices.size(), mArrays);
+        EXPECT_EQ(mSkinnedPositions, std::vector<float>({6, 22, 36, -1, -1, -1, -6, 34, 48}));
+    }
+
+    TEST_F(SceneUtilSkinVerticesTest, shouldTransformNormalsWithoutTranslation)
+    {
+        mArrays.mNormalSrc = mNormals.data();
+        mArrays.mNormalDst = mSkinnedNormals.data();
+        const std::vector<unsigned short> indices {0, 1, 2};
+        skinVertices(matrix.data(), indices.data(), indices.size(), mArrays);
+        EXPECT_EQ(mSkinnedNormals, std::vector<float>({0, 2, 0, -2, 0, 0, 0, 0, 2}));
+    }
+
+    TEST_F(SceneUtilSkinVerticesTest, shouldTransformTangentsAndKeepW)
+    {
+        mArrays.mTangentSrc = mTangents.data();
+        mArrays.mTangentDst = mSkinnedTangents.data();
+        const std::vector<unsigned short> indices {1};
+        skinVertices(matrix.data(), indices.data(), indices.size(), mArrays);
+        EXPECT_EQ(mSkinnedTangents, std::vector<float>({-1, -1, -1, -1, -2, 0, 0, -1, -1, -1, -1, -1}));
+    }
+}
@@ -0,0 +1,101 @@
+#include "../testing_util.hpp"
+
+#include <components/vfs/filesystemarchive.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+
+    char normalize(char c)
+    {
+        return c == '\\' ? '/' : c;
+    }
+
+    std::vector<std::string> listResources(VFS::FileSystemArchive& archive)
+    {
+        std::map<std::string, VFS::File*> files;
+        archive.listResources(files, &normalize);
+        std::vector<std::string> result;
+        for (const auto& [name, file] : files)
+            result.push_back(name);
+        return result;
+    }
+
+    struct VFSFileSystemArchiveTest : Test
+    {
+        const std::filesystem::path mDataPath = TestingOpenMW::temporaryFilePath("openmw_vfs_filesystemarchive_data");
+        const std::string mCachePath = TestingOpenMW::temporaryFilePath("openmw_vfs_filesystemarchive_cache")
+            + "/data.idx";
+
+        VFSFileSystemArchiveTest()
+        {
+            std::filesystem::remove_all(mDataPath);
+            std::filesystem::remove_all(std::filesystem::path(mCachePath).parent_path());
+            std::filesystem::create_directories(mDataPath / "meshes");
+            std::ofstream(mDataPath / "meshes" / "a.nif") << "a";
+        }
+
+        ~VFSFileSystemArchiveTest()
+        {
+            std::filesystem::remove_all(mDataPath);
+            std::filesystem::remove_all(std::filesystem::path(mCachePath).parent_path());
+        }
+    };
+
+    TEST_F(VFSFileSystemArchiveTest, list_resources_should_write_and_use_cached_listing)
+    {
+        VFS::FileSystemArchive first(mDataPath.string(), mCachePath);
+        EXPECT_THAT(listResources(first), ElementsAre("meshes/a.nif"));
+        EXPECT_TRUE(std::filesystem::exists(mCachePath));
+
+        // Keep the modification time so the cached listing stays valid and the new file is not found
+        const auto lastWriteTime = std::filesystem::last_write_time(mDataPath / "meshes");
+        std::ofstream(mDataPath / "meshes" / "b.nif") << "b";
+        std::filesystem::last_write_time(mDataPath / "meshes", lastWriteTime);
+
+        VFS::FileSystemArchive second(mDataPath.string(), mCachePath);
+        EXPECT_THAT(listResources(second), ElementsAre("meshes/a.nif"));
+    }
+
+    TEST_F(VFSFileSystemArchiveTest, list_resources_should_ignore_cache_when_directory_is_changed)
+    {
+        VFS::FileSystemArchive first(mDataPath.string(), mCachePath);
+        EXPECT_THAT(listResources(first), ElementsAre("meshes/a.nif"));
+
+        const auto lastWriteTime = std::filesystem::last_write_time(mDataPath / "meshes");
+        std::ofstream(mDataPath / "meshes" / "b.nif") << "b";
+        std::filesystem::last_write_time(mDataPath / "meshes", lastWriteTime + std::chrono::seconds(1));
+
+        VFS::FileSystemArchive second(mDataPath.string(), mCachePath);
+        EXPECT_THAT(listResources(second), ElementsAre("meshes/a.nif", "meshes/b.nif"));
+    }
+
+    TEST_F(VFSFileSystemArchiveTest, list_resources_should_ignore_cache_for_other_directory)
+    {
+        const std::filesystem::path otherPath = mDataPath / "meshes";
+        VFS::FileSystemArchive first(otherPath.string(), mCachePath);
+        EXPECT_THAT(listResources(first), ElementsAre("a.nif"));
+
+        VFS::FileSystemArchive second(mDataPath.string(), mCachePath);
+        EXPECT_THAT(listResources(second), ElementsAre("meshes/a.nif"));
+    }
+
+    TEST_F(VFSFileSystemArchiveTest, list_resources_should_ignore_invalid_cache)
+    {
+        std::filesystem::create_directories(std::filesystem::path(mCachePath).parent_path());
+        std::ofstream(mCachePath) << "invalid";
+
+        VFS::FileSystemArchive archive(mDataPath.string(), mCachePath);
+        EXPECT_THAT(listResources(archive), ElementsAre("meshes/a.nif"));
+    }
+}
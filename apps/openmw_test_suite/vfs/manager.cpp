@@ -0,0 +1,100 @@
+#include "../testing_util.hpp"
+
+#include <components/vfs/manager.hpp>
+#include <components/vfs/pathindex.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace TestingOpenMW;
+
+    struct VFSManagerTest : Test
+    {
+        VFSTestFile mFile {"content"};
+        VFSTestFile mOtherFile {"other"};
+    };
+
+    TEST_F(VFSManagerTest, exists_should_find_normalized_names)
+    {
+        const auto vfs = createTestVFS({{"meshes/foo.nif", &mFile}});
+        EXPECT_TRUE(vfs->exists("meshes/foo.nif"));
+        EXPECT_TRUE(vfs->exists("meshes\\foo.nif"));
+        EXPECT_FALSE(vfs->exists("meshes/bar.nif"));
+        EXPECT_FALSE(vfs->exists("meshes/foo.ni"));
+        EXPECT_FALSE(vfs->exists(""));
+    }
+
+    TEST_F(VFSManagerTest, exists_for_empty_index_should_return_false)
+    {
+        const auto vfs = createTestVFS({});
+        EXPECT_FALSE(vfs->exists("meshes/foo.nif"));
+    }
+
+    TEST_F(VFSManagerTest, non_strict_manager_should_ignore_case)
+    {
+        VFS::Manager vfs(false);
+        vfs.addArchive(std::make_unique<VFSTestData>(std::map<std::string, VFS::File*> {{"meshes/foo.nif", &mFile}}));
+        vfs.buildIndex();
+        EXPECT_TRUE(vfs.exists("Meshes\\FOO.nif"));
+        EXPECT_EQ(vfs.getAbsoluteFileName("MESHES/foo.NIF"), "TestFile");
+    }
+
+    TEST_F(VFSManagerTest, get_should_open_matching_file)
+    {
+        const auto vfs = createTestVFS({{"a.txt", &mFile}, {"b.txt", &mOtherFile}});
+        const Files::IStreamPtr stream = vfs->get("b.txt");
+        std::string content;
+        *stream >> content;
+        EXPECT_EQ(content, "other");
+    }
+
+    TEST_F(VFSManagerTest, get_should_throw_for_missing_file)
+    {
+        const auto vfs = createTestVFS({{"a.txt", &mFile}});
+        EXPECT_THROW(vfs->get("c.txt"), std::runtime_error);
+    }
+
+    TEST_F(VFSManagerTest, recursive_directory_iterator_should_return_sorted_files_with_prefix)
+    {
+        const auto vfs = createTestVFS({
+            {"music/explore/b.mp3", &mFile},
+            {"music/battle/a.mp3", &mFile},
+            {"music/explore/a.mp3", &mFile},
+            {"sound/a.wav", &mFile},
+        });
+        std::vector<std::string> files;
+        for (const auto& name : vfs->getRecursiveDirectoryIterator("music/explore/"))
+            files.push_back(name);
+        EXPECT_EQ(files, (std::vector<std::string> {"music/explore/a.mp3", "music/explore/b.mp3"}));
+    }
+
+    TEST_F(VFSManagerTest, recursive_directory_iterator_for_missing_prefix_should_be_empty)
+    {
+        const auto vfs = createTestVFS({{"sound/a.wav", &mFile}});
+        const auto range = vfs->getRecursiveDirectoryIterator("music/");
+        EXPECT_FALSE(range.begin() != range.end());
+    }
+
+    TEST(VFSPathIndexTest, find_should_handle_many_entries)
+    {
+        std::vector<VFSTestFile> files;
+        files.reserve(1000);
+        std::map<std::string, VFS::File*> paths;
+        for (int i = 0; i < 1000; ++i)
+        {
+            files.emplace_back(std::to_string(i));
+            paths.emplace("textures/tx_" + std::to_string(i) + ".dds", &files.back());
+        }
+        const VFS::PathIndex index(std::move(paths));
+        const auto identity = [] (char c) { return c; };
+        ASSERT_EQ(index.size(), 1000);
+        for (int i = 0; i < 1000; ++i)
+            EXPECT_EQ(index.find("textures/tx_" + std::to_string(i) + ".dds", identity), &files[i]) << i;
+        EXPECT_EQ(index.find("textures/tx_1000.dds", identity), nullptr);
+    }
+}
@@ -24,6 +24,7 @@
 #include "bsa_file.hpp"
 
 #include <components/files/constrainedfilestream.hpp>
+#include <components/files/memorystream.hpp>
 
 #include <algorithm>
 #include <cassert>
@@ -35,7 +36,7 @@ using namespace Bsa;
 
 
 /// Error handling
-[[noreturn]] void BSAFile::fail(const std::string &msg)
+[[noreturn]] void BSAFile::fail(const std::string &msg) const
 {
     throw std::runtime_error("BSA Error: " + msg + "\nArchive: " + mFilename);
 }
@@ -231,14 +232,23 @@ void Bsa::BSAFile::writeHeader()
 }
 
 /// Open an archive file.
-void BSAFile::open(const std::string &file)
+void BSAFile::open(const std::string &file, bool memoryMapped)
 {
     if (mIsLoaded)
         close();
 
     mFilename = file;
     if(std::filesystem::exists(file))
+    {
+        if (memoryMapped)
+        {
+            Platform::File::ScopedHandle handle = Platform::File::open(file.c_str());
+            const std::size_t size = Platform::File::size(handle);
+            if (size != 0)
+                mMapping = Platform::File::ScopedMapping(Platform::File::map(handle, size), size);
+        }
         readHeader();
+    }
     else
     {
         { std::fstream(mFilename, std::ios::binary | std::ios::out); }
@@ -255,12 +265,25 @@ void Bsa::BSAFile::close()
 
     mFiles.clear();
     mStringBuf.clear();
+    mMapping = Platform::File::ScopedMapping();
     mIsLoaded = false;
 }
 
+Files::IStreamPtr Bsa::BSAFile::openStream(std::size_t offset, std::size_t size) const
+{
+    if (mMapping)
+    {
+        if (offset > mMapping.size() || size > mMapping.size() - offset)
+            fail("File data at offset " + std::to_string(offset) + " with size " + std::to_string(size)
+                + " is outside the archive");
+        return std::make_unique<Files::IMemStream>(mMapping.data() + offset, size);
+    }
+    return Files::openConstrainedFileStream(mFilename, offset, size);
+}
+
 Files::IStreamPtr Bsa::BSAFile::getFile(const FileStruct *file)
 {
-    return Files::openConstrainedFileStream(mFilename, file->offset, file->fileSize);
+    return openStream(file->offset, file->fileSize);
 }
 
 void Bsa::BSAFile::addFile(const std::string& filename, std::istream& file)
@@ -268,6 +291,9 @@ void Bsa::BSAFile::addFile(const std::string& filename, std::istream& file)
     if (!mIsLoaded)
         fail("Unable to add file " + filename + " the archive is not opened");
 
+    if (mMapping)
+        fail("Unable to add file " + filename + " the archive is opened as memory mapped");
+
     auto newStartOfDataBuffer = 12 + (12 + 8) * (mFiles.size() + 1) + mStringBuf.size() + filename.size() + 1;
     if (mFiles.empty())
         std::filesystem::resize_file(mFilename, newStartOfDataBuffer);
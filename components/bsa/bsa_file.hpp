@@ -29,6 +29,7 @@
 #include <vector>
 
 #include <components/files/istreamptr.hpp>
+#include <components/platform/file.hpp>
 
 namespace Bsa
 {
@@ -87,13 +88,20 @@ protected:
     /// Used for error messages
     std::string mFilename;
 
+    /// Whole archive mapped into memory, empty unless opened as memory mapped
+    Platform::File::ScopedMapping mMapping;
+
     /// Error handling
-    [[noreturn]] void fail(const std::string &msg);
+    [[noreturn]] void fail(const std::string &msg) const;
 
     /// Read header information from the input source
     virtual void readHeader();
     virtual void writeHeader();
 
+    /// Open a stream over the given range of the archive. Reads directly from the mapped
+    /// memory when the archive is memory mapped.
+    Files::IStreamPtr openStream(std::size_t offset, std::size_t size) const;
+
 public:
     /* -----------------------------------
      * BSA management methods
@@ -110,7 +118,9 @@ public:
     }
 
     /// Open an archive file.
-    void open(const std::string &file);
+    /// @param memoryMapped Map the whole archive into memory so files are served without
+    /// further system calls. Only valid for existing archives that are not modified.
+    void open(const std::string &file, bool memoryMapped = false);
 
     void close();
 
@@ -121,6 +131,8 @@ public:
 
     /** Open a file contained in the archive.
      * @note Thread safe.
+     * @note For memory mapped archives the stream refers to the mapped memory and
+     * must not outlive the archive.
     */
     Files::IStreamPtr getFile(const FileStruct *file);
 
@@ -45,12 +45,42 @@
 #endif
 
 #include <boost/iostreams/device/array.hpp>
+#include <components/bsa/decompressedfilecache.hpp>
 #include <components/bsa/memorystream.hpp>
 #include <components/misc/strings/lower.hpp>
 #include <components/files/constrainedfilestream.hpp>
+#include <components/files/memorystream.hpp>
 
 namespace Bsa
 {
+namespace
+{
+    struct LZ4DecompressionContext
+    {
+        LZ4F_decompressionContext_t mContext = nullptr;
+
+        LZ4DecompressionContext()
+        {
+            const LZ4F_errorCode_t errorCode = LZ4F_createDecompressionContext(&mContext, LZ4F_VERSION);
+            if (LZ4F_isError(errorCode))
+                throw std::runtime_error(std::string("Failed to create LZ4 decompression context: ") + LZ4F_getErrorName(errorCode));
+        }
+
+        ~LZ4DecompressionContext()
+        {
+            LZ4F_freeDecompressionContext(mContext);
+        }
+
+        LZ4DecompressionContext(const LZ4DecompressionContext&) = delete;
+        LZ4DecompressionContext& operator=(const LZ4DecompressionContext&) = delete;
+    };
+
+    // Decompression state and buffers are reused by all archives read from the same thread
+    thread_local std::unique_ptr<LZ4DecompressionContext> sLZ4Context;
+    thread_local std::unique_ptr<boost::iostreams::zlib_decompressor> sZlibDecompressor;
+    thread_local std::vector<char> sCompressedBuffer;
+}
+
 //special marker for invalid records,
 //equal to max uint32_t value
 const uint32_t CompressedBSAFile::sInvalidOffset = std::numeric_limits<uint32_t>::max();
@@ -112,7 +142,18 @@ CompressedBSAFile::CompressedBSAFile()
     : mCompressedByDefault(false), mEmbeddedFileNames(false)
 { }
 
-CompressedBSAFile::~CompressedBSAFile() = default;
+CompressedBSAFile::~CompressedBSAFile()
+{
+    if (mCache != nullptr)
+        mCache->remove(this);
+}
+
+void CompressedBSAFile::setCache(std::shared_ptr<DecompressedFileCache> cache)
+{
+    if (mCache != nullptr)
+        mCache->remove(this);
+    mCache = std::move(cache);
+}
 
 /// Read header information from the input source
 void CompressedBSAFile::readHeader()
@@ -353,7 +394,14 @@ Files::IStreamPtr CompressedBSAFile::getFile(const FileRecord& fileRecord)
     size_t size = fileRecord.getSizeWithoutCompressionFlag();
     size_t uncompressedSize = size;
     bool compressed = fileRecord.isCompressed(mCompressedByDefault);
-    Files::IStreamPtr streamPtr = Files::openConstrainedFileStream(mFilename, fileRecord.offset, size);
+
+    if (compressed && mCache != nullptr)
+    {
+        if (DecompressedFile cached = mCache->get(this, fileRecord.offset))
+            return std::make_unique<SharedMemoryInputStream>(std::move(cached));
+    }
+
+    Files::IStreamPtr streamPtr = openStream(fileRecord.offset, size);
     std::istream* fileStream = streamPtr.get();
     if (mEmbeddedFileNames)
     {
@@ -368,40 +416,74 @@ Files::IStreamPtr CompressedBSAFile::getFile(const FileRecord& fileRecord)
         fileStream->read(reinterpret_cast<char*>(&uncompressedSize), sizeof(uint32_t));
         size -= sizeof(uint32_t);
     }
-    auto memoryStreamPtr = std::make_unique<MemoryInputStream>(uncompressedSize);
+    // Uncompressed files of a memory mapped archive are served without a copy
+    const char* fileData = nullptr;
+    if (mMapping)
+    {
+        // openStream has checked the record against the mapping, the data must stay within the record
+        const std::streamoff position = fileStream->tellg();
+        const std::size_t recordSize = fileRecord.getSizeWithoutCompressionFlag();
+        if (!*fileStream || position < 0 || static_cast<std::size_t>(position) > recordSize
+                || size > recordSize - static_cast<std::size_t>(position))
+            fail("Corrupted file record at offset " + std::to_string(fileRecord.offset));
+        fileData = mMapping.data() + fileRecord.offset + static_cast<std::size_t>(position);
+    }
+    if (fileData != nullptr && !compressed)
+        return std::make_unique<Files::IMemStream>(fileData, size);
 
-    if (compressed)
+    if (!compressed)
     {
-        if (mVersion != 0x69) // Non-SSE: zlib
-        {
-            boost::iostreams::filtering_streambuf<boost::iostreams::input> inputStreamBuf;
-            inputStreamBuf.push(boost::iostreams::zlib_decompressor());
-            inputStreamBuf.push(*fileStream);
+        auto memoryStreamPtr = std::make_unique<MemoryInputStream>(uncompressedSize);
+        fileStream->read(memoryStreamPtr->getRawData(), size);
+        return std::make_unique<Files::StreamWithBuffer<MemoryInputStream>>(std::move(memoryStreamPtr));
+    }
 
-            boost::iostreams::basic_array_sink<char> sr(memoryStreamPtr->getRawData(), uncompressedSize);
-            boost::iostreams::copy(inputStreamBuf, sr);
-        }
-        else // SSE: lz4
+    if (fileData == nullptr)
+    {
+        sCompressedBuffer.resize(size);
+        fileStream->read(sCompressedBuffer.data(), size);
+        fileData = sCompressedBuffer.data();
+    }
+
+    auto decompressed = std::make_shared<std::vector<char>>(uncompressedSize);
+    decompress(fileData, size, decompressed->data(), uncompressedSize);
+
+    if (mCache != nullptr)
+        mCache->put(this, fileRecord.offset, decompressed);
+
+    return std::make_unique<SharedMemoryInputStream>(std::move(decompressed));
+}
+
+void CompressedBSAFile::decompress(const char* data, std::size_t size, char* dest, std::size_t uncompressedSize)
+{
+    if (mVersion != 0x69) // Non-SSE: zlib
+    {
+        if (sZlibDecompressor == nullptr)
+            sZlibDecompressor = std::make_unique<boost::iostreams::zlib_decompressor>();
+
+        // Copies of the decompressor share its zlib state, closing the chain at the end of copy resets it for reuse
+        boost::iostreams::filtering_streambuf<boost::iostreams::input> inputStreamBuf;
+        inputStreamBuf.push(*sZlibDecompressor);
+        inputStreamBuf.push(boost::iostreams::array_source(data, size));
+
+        boost::iostreams::basic_array_sink<char> sr(dest, uncompressedSize);
+        boost::iostreams::copy(inputStreamBuf, sr);
+    }
+    else // SSE: lz4
+    {
+        if (sLZ4Context == nullptr)
+            sLZ4Context = std::make_unique<LZ4DecompressionContext>();
+
+        LZ4F_decompressOptions_t options = {};
+        LZ4F_errorCode_t errorCode = LZ4F_decompress(sLZ4Context->mContext, dest, &uncompressedSize, data, &size, &options);
+        if (errorCode != 0)
         {
-            auto buffer = std::vector<char>(size);
-            fileStream->read(buffer.data(), size);
-            LZ4F_decompressionContext_t context = nullptr;
-            LZ4F_createDecompressionContext(&context, LZ4F_VERSION);
-            LZ4F_decompressOptions_t options = {};
-            LZ4F_errorCode_t errorCode = LZ4F_decompress(context, memoryStreamPtr->getRawData(), &uncompressedSize, buffer.data(), &size, &options);
-            if (LZ4F_isError(errorCode))
-                fail("LZ4 decompression error (file " + mFilename + "): " + LZ4F_getErrorName(errorCode));
-            errorCode = LZ4F_freeDecompressionContext(context);
+            // Context is reset only after a complete frame, drop it to not affect the next file
+            sLZ4Context = nullptr;
             if (LZ4F_isError(errorCode))
                 fail("LZ4 decompression error (file " + mFilename + "): " + LZ4F_getErrorName(errorCode));
         }
     }
-    else
-    {
-        fileStream->read(memoryStreamPtr->getRawData(), size);
-    }
-
-    return std::make_unique<Files::StreamWithBuffer<MemoryInputStream>>(std::move(memoryStreamPtr));
 }
 
 BsaVersion CompressedBSAFile::detectVersion(const std::string& filePath)
@@ -455,7 +537,7 @@ void CompressedBSAFile::convertCompressedSizesToUncompressed()
             continue;
         }
 
-        Files::IStreamPtr dataBegin = Files::openConstrainedFileStream(mFilename, fileRecord.offset, fileRecord.getSizeWithoutCompressionFlag());
+        Files::IStreamPtr dataBegin = openStream(fileRecord.offset, fileRecord.getSizeWithoutCompressionFlag());
 
         if (mEmbeddedFileNames)
         {
@@ -27,6 +27,7 @@
 #define BSA_COMPRESSED_BSA_FILE_H
 
 #include <map>
+#include <memory>
 
 #include <components/bsa/bsa_file.hpp>
 
@@ -39,6 +40,8 @@ namespace Bsa
         BSAVER_COMPRESSED = 0x415342 //B, S, A
     };
 
+    class DecompressedFileCache;
+
     class CompressedBSAFile : private BSAFile
     {
     private:
@@ -76,6 +79,8 @@ namespace Bsa
         };
         std::map<std::uint64_t, FolderRecord> mFolders;
 
+        std::shared_ptr<DecompressedFileCache> mCache;
+
         FileRecord getFileRecord(const std::string& str) const;
         
         void getBZString(std::string& str, std::istream& filestream);
@@ -84,6 +89,7 @@ namespace Bsa
         /// \brief Normalizes given filename or folder and generates format-compatible hash. See https://en.uesp.net/wiki/Tes4Mod:Hash_Calculation.
         static std::uint64_t generateHash(std::string stem, std::string extension) ;
         Files::IStreamPtr getFile(const FileRecord& fileRecord);
+        void decompress(const char* data, std::size_t size, char* dest, std::size_t uncompressedSize);
     public:
         using BSAFile::open;
         using BSAFile::getList;
@@ -97,6 +103,9 @@ namespace Bsa
 
         /// Read header information from the input source
         void readHeader() override;
+
+        /// Keep recently decompressed files in the given cache, it may be shared with other archives.
+        void setCache(std::shared_ptr<DecompressedFileCache> cache);
        
         Files::IStreamPtr getFile(const char* filePath);
         Files::IStreamPtr getFile(const FileStruct* fileStruct);
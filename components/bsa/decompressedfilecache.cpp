@@ -0,0 +1,82 @@
+#include "decompressedfilecache.hpp"
+
+#include <components/misc/hash.hpp>
+
+namespace Bsa
+{
+    std::size_t DecompressedFileCache::KeyHash::operator()(const Key& key) const
+    {
+        std::size_t seed = 0;
+        Misc::hashCombine(seed, key.first);
+        Misc::hashCombine(seed, key.second);
+        return seed;
+    }
+
+    DecompressedFileCache::DecompressedFileCache(std::size_t maxSize)
+        : mMaxSize(maxSize)
+    {
+    }
+
+    DecompressedFile DecompressedFileCache::get(const void* archive, std::uint32_t offset)
+    {
+        const std::lock_guard<std::mutex> lock(mMutex);
+        const auto it = mIndex.find(Key(archive, offset));
+        if (it == mIndex.end())
+        {
+            ++mStats.mMisses;
+            return nullptr;
+        }
+        ++mStats.mHits;
+        mItems.splice(mItems.end(), mItems, it->second);
+        return it->second->mFile;
+    }
+
+    void DecompressedFileCache::put(const void* archive, std::uint32_t offset, DecompressedFile file)
+    {
+        const std::size_t size = file->size();
+        if (size > mMaxSize)
+            return;
+        const std::lock_guard<std::mutex> lock(mMutex);
+        const Key key(archive, offset);
+        if (mIndex.find(key) != mIndex.end())
+            return;
+        while (!mItems.empty() && mStats.mSize + size > mMaxSize)
+            removeLeastRecentlyUsed();
+        const auto it = mItems.insert(mItems.end(), Item {key, std::move(file)});
+        mIndex.emplace(key, it);
+        mStats.mSize += size;
+        ++mStats.mCount;
+    }
+
+    void DecompressedFileCache::remove(const void* archive)
+    {
+        const std::lock_guard<std::mutex> lock(mMutex);
+        for (auto it = mItems.begin(); it != mItems.end();)
+        {
+            if (it->mKey.first != archive)
+            {
+                ++it;
+                continue;
+            }
+            mStats.mSize -= it->mFile->size();
+            --mStats.mCount;
+            mIndex.erase(it->mKey);
+            it = mItems.erase(it);
+        }
+    }
+
+    DecompressedFileCache::Stats DecompressedFileCache::getStats() const
+    {
+        const std::lock_guard<std::mutex> lock(mMutex);
+        return mStats;
+    }
+
+    void DecompressedFileCache::removeLeastRecentlyUsed()
+    {
+        const Item& item = mItems.front();
+        mStats.mSize -= item.mFile->size();
+        --mStats.mCount;
+        mIndex.erase(item.mKey);
+        mItems.pop_front();
+    }
+}
@@ -0,0 +1,66 @@
+#ifndef BSA_DECOMPRESSED_FILE_CACHE_H
+#define BSA_DECOMPRESSED_FILE_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Bsa
+{
+    using DecompressedFile = std::shared_ptr<const std::vector<char>>;
+
+    /// @brief Thread safe LRU cache of decompressed archive files bounded by total size in bytes.
+    /// @par Can be shared by multiple archives. Files are identified by the owning archive and the file offset.
+    class DecompressedFileCache
+    {
+    public:
+        struct Stats
+        {
+            std::size_t mSize = 0;
+            std::size_t mCount = 0;
+            std::size_t mHits = 0;
+            std::size_t mMisses = 0;
+        };
+
+        explicit DecompressedFileCache(std::size_t maxSize);
+
+        DecompressedFile get(const void* archive, std::uint32_t offset);
+
+        /// Files larger than the cache size are not stored.
+        void put(const void* archive, std::uint32_t offset, DecompressedFile file);
+
+        /// Drop all files of the given archive.
+        void remove(const void* archive);
+
+        Stats getStats() const;
+
+    private:
+        using Key = std::pair<const void*, std::uint32_t>;
+
+        struct KeyHash
+        {
+            std::size_t operator()(const Key& key) const;
+        };
+
+        struct Item
+        {
+            Key mKey;
+            DecompressedFile mFile;
+        };
+
+        const std::size_t mMaxSize;
+        mutable std::mutex mMutex;
+        std::list<Item> mItems;
+        std::unordered_map<Key, std::list<Item>::iterator, KeyHash> mIndex;
+        Stats mStats;
+
+        void removeLeastRecentlyUsed();
+    };
+}
+
+#endif
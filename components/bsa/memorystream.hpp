@@ -28,6 +28,7 @@
 
 #include <vector>
 #include <istream>
+#include <memory>
 #include <components/files/memorystream.hpp>
 
 namespace Bsa
@@ -54,5 +55,24 @@ public:
     }
 };
 
+struct SharedMemoryBuffer
+{
+    std::shared_ptr<const std::vector<char>> mBuffer;
+};
+
+/**
+    Allows to pass a memory buffer shared with other owners (e.g. a cache) as Files::IStreamPtr.
+
+    Memory buffer is kept alive while the class instance exists.
+ */
+class SharedMemoryInputStream : private SharedMemoryBuffer, public Files::MemBuf, public std::istream {
+public:
+    explicit SharedMemoryInputStream(std::shared_ptr<const std::vector<char>> buffer)
+        : SharedMemoryBuffer {std::move(buffer)}
+        , Files::MemBuf(mBuffer->data(), mBuffer->size())
+        , std::istream(static_cast<std::streambuf*>(this))
+    {}
+};
+
 }
 #endif
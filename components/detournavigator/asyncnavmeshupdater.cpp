@@ -22,6 +22,7 @@
 #include <numeric>
 #include <set>
 #include <type_traits>
+#include <utility>
 
 namespace DetourNavigator
 {
@@ -93,7 +94,8 @@ namespace DetourNavigator
             if (db == nullptr)
                 return nullptr;
             return std::make_unique<DbWorker>(updater, std::move(db), TileVersion(navMeshFormatVersion),
-                                              settings.mRecast, settings.mWriteToNavMeshDb);
+                                              settings.mRecast, settings.mWriteToNavMeshDb,
+                                              settings.mDbWriteBatchSize, settings.mDbWriteBatchInterval);
         }
 
         void updateJobs(std::deque<JobIt>& jobs, TilePosition playerTile, int maxTiles)
@@ -330,6 +332,8 @@ namespace DetourNavigator
         if (stats.mDb.has_value())
         {
             out.setAttribute(frameNumber, "NavMesh DbJobs", static_cast<double>(stats.mDb->mJobs));
+            out.setAttribute(frameNumber, "NavMesh DbWrittenTiles", static_cast<double>(stats.mDb->mWrittenTiles));
+            out.setAttribute(frameNumber, "NavMesh DbCommits", static_cast<double>(stats.mDb->mCommits));
 
             if (stats.mDb->mGetTileCount > 0)
                 out.setAttribute(frameNumber, "NavMesh DbCacheHitRate", static_cast<double>(stats.mDbGetTileHits)
@@ -483,7 +487,7 @@ namespace DetourNavigator
         std::unique_ptr<PreparedNavMeshData> preparedNavMeshData;
         bool generatedNavMeshData = false;
 
-        if (job.mCachedTileData.has_value() && job.mCachedTileData->mVersion == navMeshFormatVersion)
+        if (job.mCachedTileData.has_value() && isSupportedNavMeshFormatVersion(job.mCachedTileData->mVersion))
         {
             preparedNavMeshData = std::make_unique<PreparedNavMeshData>();
             if (deserialize(job.mCachedTileData->mData, *preparedNavMeshData))
@@ -694,10 +698,14 @@ namespace DetourNavigator
         mHasJob.notify_all();
     }
 
-    std::optional<JobIt> DbJobQueue::pop()
+    std::optional<JobIt> DbJobQueue::pop(std::optional<std::chrono::steady_clock::time_point> deadline)
     {
         std::unique_lock lock(mMutex);
-        mHasJob.wait(lock, [&] { return mShouldStop || !mJobs.empty(); });
+        const auto hasJob = [&] { return mShouldStop || !mJobs.empty(); };
+        if (deadline.has_value())
+            mHasJob.wait_until(lock, *deadline, hasJob);
+        else
+            mHasJob.wait(lock, hasJob);
         if (mJobs.empty())
             return std::nullopt;
         const JobIt job = mJobs.front();
@@ -727,12 +735,15 @@ namespace DetourNavigator
     }
 
     DbWorker::DbWorker(AsyncNavMeshUpdater& updater, std::unique_ptr<NavMeshDb>&& db,
-        TileVersion version, const RecastSettings& recastSettings, bool writeToDb)
+        TileVersion version, const RecastSettings& recastSettings, bool writeToDb,
+        std::size_t writeBatchSize, std::chrono::milliseconds writeBatchInterval)
         : mUpdater(updater)
         , mRecastSettings(recastSettings)
         , mDb(std::move(db))
         , mVersion(version)
         , mWriteToDb(writeToDb)
+        , mWriteBatchSize(std::max<std::size_t>(writeBatchSize, 1))
+        , mWriteBatchInterval(writeBatchInterval)
         , mNextTileId(mDb->getMaxTileId() + 1)
         , mNextShapeId(mDb->getMaxShapeId() + 1)
         , mThread([this] { run(); })
@@ -755,6 +766,8 @@ namespace DetourNavigator
         Stats result;
         result.mJobs = mQueue.size();
         result.mGetTileCount = mGetTileCount.load(std::memory_order_relaxed);
+        result.mWrittenTiles = mWrittenTiles.load(std::memory_order_relaxed);
+        result.mCommits = mCommits.load(std::memory_order_relaxed);
         return result;
     }
 
@@ -772,14 +785,30 @@ namespace DetourNavigator
         {
             try
             {
-                if (const auto job = mQueue.pop())
+                std::optional<std::chrono::steady_clock::time_point> deadline;
+                if (mTransaction.has_value())
+                    deadline = mTransactionStart + mWriteBatchInterval;
+                if (const auto job = mQueue.pop(deadline))
                     processJob(*job);
+                if (mTransaction.has_value() && (mTransactionWrites.size() >= mWriteBatchSize
+                        || std::chrono::steady_clock::now() >= mTransactionStart + mWriteBatchInterval))
+                    commitWrites();
             }
             catch (const std::exception& e)
             {
                 Log(Debug::Error) << "DbWorker exception: " << e.what();
             }
         }
+        try
+        {
+            commitWrites();
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Error) << "DbWorker exception on final commit: " << e.what();
+        }
+        Log(Debug::Verbose) << "DbWorker has written " << mWrittenTiles.load() << " navmesh tiles using "
+            << mCommits.load() << " transactions";
     }
 
     void DbWorker::processJob(JobIt job)
@@ -859,6 +888,8 @@ namespace DetourNavigator
 
         Log(Debug::Debug) << "Processing db write job " << job->mId;
 
+        startWriting();
+
         if (job->mInput.empty())
         {
             Log(Debug::Debug) << "Serializing input for job " << job->mId;
@@ -871,12 +902,13 @@ namespace DetourNavigator
         {
             Log(Debug::Debug) << "Update db tile by job " << job->mId;
             job->mGeneratedNavMeshData->mUserId = cachedTileData->mTileId;
-            mDb->updateTile(cachedTileData->mTileId, mVersion, serialize(*job->mGeneratedNavMeshData));
+            writeTile(TileWrite {cachedTileData->mTileId, true, job->mWorldspace, job->mChangedTile, {},
+                serialize(*job->mGeneratedNavMeshData)});
             return;
         }
 
         const auto cached = mDb->findTile(job->mWorldspace, job->mChangedTile, job->mInput);
-        if (cached.has_value() && cached->mVersion == mVersion)
+        if (cached.has_value() && isSupportedNavMeshFormatVersion(cached->mVersion))
         {
             Log(Debug::Debug) << "Ignore existing db tile by job " << job->mId;
             return;
@@ -884,8 +916,89 @@ namespace DetourNavigator
 
         job->mGeneratedNavMeshData->mUserId = mNextTileId;
         Log(Debug::Debug) << "Insert db tile by job " << job->mId;
-        mDb->insertTile(mNextTileId, job->mWorldspace, job->mChangedTile,
-                        mVersion, job->mInput, serialize(*job->mGeneratedNavMeshData));
+        writeTile(TileWrite {mNextTileId, false, job->mWorldspace, job->mChangedTile, job->mInput,
+            serialize(*job->mGeneratedNavMeshData)});
         ++mNextTileId;
     }
+
+    void DbWorker::startWriting()
+    {
+        if (mTransaction.has_value())
+            return;
+        mTransaction.emplace(mDb->startTransaction(Sqlite3::TransactionMode::Immediate));
+        mTransactionStart = std::chrono::steady_clock::now();
+        mTransactionWrites.clear();
+    }
+
+    void DbWorker::writeTile(TileWrite&& write)
+    {
+        try
+        {
+            applyTileWrite(write);
+        }
+        catch (const std::exception&)
+        {
+            // SQLite may roll back the whole transaction on a failed statement, tiles written before would be lost
+            rewriteTilesSeparately();
+            throw;
+        }
+        mTransactionWrites.push_back(std::move(write));
+    }
+
+    void DbWorker::applyTileWrite(const TileWrite& write)
+    {
+        if (write.mUpdate)
+            mDb->updateTile(write.mTileId, mVersion, write.mData);
+        else
+            mDb->insertTile(write.mTileId, write.mWorldspace, write.mTilePosition, mVersion, write.mInput, write.mData);
+    }
+
+    void DbWorker::commitWrites()
+    {
+        if (!mTransaction.has_value())
+            return;
+        const std::size_t tiles = mTransactionWrites.size();
+        Log(Debug::Debug) << "Committing " << tiles << " db tiles";
+        try
+        {
+            mTransaction->commit();
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to commit " << tiles << " db tiles, writing them separately: " << e.what();
+            rewriteTilesSeparately();
+            return;
+        }
+        mTransaction.reset();
+        mTransactionWrites.clear();
+        mWrittenTiles.fetch_add(tiles, std::memory_order_relaxed);
+        mCommits.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void DbWorker::rewriteTilesSeparately()
+    {
+        // Destruction of not committed transaction rolls it back
+        mTransaction.reset();
+        const std::vector<TileWrite> writes = std::exchange(mTransactionWrites, {});
+        std::size_t failed = 0;
+        for (const TileWrite& write : writes)
+        {
+            try
+            {
+                Sqlite3::Transaction transaction = mDb->startTransaction(Sqlite3::TransactionMode::Immediate);
+                applyTileWrite(write);
+                transaction.commit();
+                mWrittenTiles.fetch_add(1, std::memory_order_relaxed);
+                mCommits.fetch_add(1, std::memory_order_relaxed);
+            }
+            catch (const std::exception& e)
+            {
+                ++failed;
+                Log(Debug::Debug) << "Failed to write db tile " << write.mTileId << ": " << e.what();
+            }
+        }
+        if (failed != 0)
+            Log(Debug::Warning) << "Failed to write " << failed << " of " << writes.size()
+                << " db tiles from a rolled back transaction";
+    }
 }
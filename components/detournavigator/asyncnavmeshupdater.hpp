@@ -22,11 +22,13 @@
 #include <mutex>
 #include <deque>
 #include <set>
+#include <string>
 #include <thread>
 #include <tuple>
 #include <list>
 #include <optional>
 #include <iosfwd>
+#include <vector>
 
 class dtNavMesh;
 
@@ -82,7 +84,7 @@ namespace DetourNavigator
     public:
         void push(JobIt job);
 
-        std::optional<JobIt> pop();
+        std::optional<JobIt> pop(std::optional<std::chrono::steady_clock::time_point> deadline = std::nullopt);
 
         void update(TilePosition playerTile, int maxTiles);
 
@@ -106,10 +108,13 @@ namespace DetourNavigator
         {
             std::size_t mJobs = 0;
             std::size_t mGetTileCount = 0;
+            std::size_t mWrittenTiles = 0;
+            std::size_t mCommits = 0;
         };
 
         DbWorker(AsyncNavMeshUpdater& updater, std::unique_ptr<NavMeshDb>&& db,
-            TileVersion version, const RecastSettings& recastSettings, bool writeToDb);
+            TileVersion version, const RecastSettings& recastSettings, bool writeToDb,
+            std::size_t writeBatchSize, std::chrono::milliseconds writeBatchInterval);
 
         ~DbWorker();
 
@@ -122,16 +127,35 @@ namespace DetourNavigator
         void stop();
 
     private:
+        struct TileWrite
+        {
+            TileId mTileId;
+            bool mUpdate;
+            std::string mWorldspace;
+            TilePosition mTilePosition;
+            std::vector<std::byte> mInput;
+            std::vector<std::byte> mData;
+        };
+
         AsyncNavMeshUpdater& mUpdater;
         const RecastSettings& mRecastSettings;
         const std::unique_ptr<NavMeshDb> mDb;
         const TileVersion mVersion;
         bool mWriteToDb;
+        const std::size_t mWriteBatchSize;
+        const std::chrono::milliseconds mWriteBatchInterval;
         TileId mNextTileId;
         ShapeId mNextShapeId;
         DbJobQueue mQueue;
+        // Tiles are written in batches grouped into a single transaction to avoid sync to disk per each tile
+        std::optional<Sqlite3::Transaction> mTransaction;
+        std::chrono::steady_clock::time_point mTransactionStart;
+        // Kept until commit to write them again in separate transactions if the batch is rolled back
+        std::vector<TileWrite> mTransactionWrites;
         std::atomic_bool mShouldStop {false};
         std::atomic_size_t mGetTileCount {0};
+        std::atomic_size_t mWrittenTiles {0};
+        std::atomic_size_t mCommits {0};
         std::thread mThread;
 
         inline void run() noexcept;
@@ -141,6 +165,16 @@ namespace DetourNavigator
         inline void processReadingJob(JobIt job);
 
         inline void processWritingJob(JobIt job);
+
+        inline void startWriting();
+
+        inline void writeTile(TileWrite&& write);
+
+        inline void applyTileWrite(const TileWrite& write);
+
+        inline void commitWrites();
+
+        inline void rewriteTilesSeparately();
     };
 
     class AsyncNavMeshUpdater
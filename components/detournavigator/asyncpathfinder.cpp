@@ -0,0 +1,228 @@
+#include "asyncpathfinder.hpp"
+#include "findsmoothpath.hpp"
+#include "settings.hpp"
+#include "settingsutils.hpp"
+
+#include <components/debug/debuglog.hpp>
+#include <components/misc/thread.hpp>
+
+#include <DetourNavMeshQuery.h>
+
+#include <osg/Stats>
+
+#include <iterator>
+
+namespace DetourNavigator
+{
+    namespace
+    {
+        // Number of polygon search iterations done while navmesh is locked
+        constexpr int sliceIterations = 256;
+
+        void call(const PathCallback& callback, PathResult&& result, std::exception_ptr error) noexcept
+        {
+            try
+            {
+                callback(std::move(result), error);
+            }
+            catch (const std::exception& e)
+            {
+                Log(Debug::Error) << "Path request callback has failed: " << e.what();
+            }
+            catch (...)
+            {
+                Log(Debug::Error) << "Path request callback has failed with unknown exception";
+            }
+        }
+    }
+
+    AsyncPathfinder::AsyncPathfinder(const Settings& settings)
+        : mSettings(settings)
+    {
+        for (std::size_t i = 0; i < mSettings.mAsyncPathfinderThreads; ++i)
+            mThreads.emplace_back([&] { run(); });
+    }
+
+    AsyncPathfinder::~AsyncPathfinder()
+    {
+        stop();
+    }
+
+    void AsyncPathfinder::post(PathRequest&& request)
+    {
+        if (mThreads.empty())
+        {
+            PathResult result;
+            std::exception_ptr error;
+            try
+            {
+                result = process(request, getThreadPathfindingQuery());
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+            call(request.mCallback, std::move(result), error);
+            return;
+        }
+
+        const std::lock_guard lock(mMutex);
+        if (mShouldStop)
+            return;
+        mRequests.push_back(std::move(request));
+        mHasRequest.notify_one();
+    }
+
+    void AsyncPathfinder::stop()
+    {
+        std::unique_lock lock(mMutex);
+        mShouldStop = true;
+        mRequests.clear();
+        mHasRequest.notify_all();
+        lock.unlock();
+        for (auto& thread : mThreads)
+            if (thread.joinable())
+                thread.join();
+    }
+
+    AsyncPathfinder::Stats AsyncPathfinder::getStats() const
+    {
+        Stats result;
+        {
+            const std::lock_guard lock(mMutex);
+            result.mRequests = mRequests.size();
+        }
+        result.mProcessing = mProcessing.load();
+        return result;
+    }
+
+    void AsyncPathfinder::run() noexcept
+    {
+        Log(Debug::Debug) << "Start process path requests by thread=" << std::this_thread::get_id();
+        Misc::setCurrentThreadIdlePriority();
+        PathfindingQuery query;
+        while (true)
+        {
+            std::unique_lock lock(mMutex);
+            mHasRequest.wait(lock, [&] { return mShouldStop || !mRequests.empty(); });
+            if (mShouldStop)
+                break;
+            PathRequest request = std::move(mRequests.front());
+            mRequests.pop_front();
+            ++mProcessing;
+            lock.unlock();
+            PathResult result;
+            std::exception_ptr error;
+            try
+            {
+                result = process(request, query);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+            call(request.mCallback, std::move(result), error);
+            --mProcessing;
+        }
+        Log(Debug::Debug) << "Stop process path requests by thread=" << std::this_thread::get_id();
+    }
+
+    PathResult AsyncPathfinder::process(const PathRequest& request, PathfindingQuery& query) const
+    {
+        PathResult result;
+
+        const auto navMeshCacheItem = request.mNavMeshCacheItem.lock();
+        if (navMeshCacheItem == nullptr)
+        {
+            result.mStatus = Status::NavMeshNotFound;
+            return result;
+        }
+
+        const osg::Vec3f halfExtents = toNavMeshCoordinates(mSettings.mRecast, request.mAgentHalfExtents);
+        const float stepSize = toNavMeshCoordinates(mSettings.mRecast, request.mStepSize);
+        const osg::Vec3f start = toNavMeshCoordinates(mSettings.mRecast, request.mStart);
+        const osg::Vec3f end = toNavMeshCoordinates(mSettings.mRecast, request.mEnd);
+        const dtQueryFilter queryFilter = makeQueryFilter(request.mIncludeFlags, request.mAreaCosts);
+        dtNavMeshQuery& navMeshQuery = query.mNavMeshQuery;
+        std::vector<dtPolyRef>& polygonPath = query.mPolygonPath;
+        polygonPath.resize(mSettings.mDetour.mMaxPolygonPathSize);
+        dtPolyRef endRef = 0;
+        PathCacheKey key {};
+        Version version;
+
+        {
+            const auto locked = navMeshCacheItem->lock();
+
+            if (!initNavMeshQuery(navMeshQuery, locked->getImpl(), mSettings.mDetour.mMaxNavMeshQueryNodes))
+            {
+                result.mStatus = Status::InitNavMeshQueryFailed;
+                return result;
+            }
+
+            dtPolyRef startRef = 0;
+            result.mStatus = findPathEndPolygons(navMeshQuery, queryFilter, halfExtents, start, end,
+                request.mEndTolerance, startRef, endRef);
+            if (result.mStatus != Status::Success)
+                return result;
+
+            key = PathCacheKey {startRef, endRef, request.mIncludeFlags, request.mAreaCosts};
+            if (const auto cachedSize = locked->getCachedPath(key, polygonPath))
+            {
+                result.mStatus = makeSmoothPathFromPolygonPath(locked->getImpl(), navMeshQuery, queryFilter, start,
+                    end, stepSize, endRef, polygonPath, *cachedSize, mSettings, std::back_inserter(result.mPath));
+                return result;
+            }
+
+            if (dtStatusFailed(navMeshQuery.initSlicedFindPath(startRef, endRef, start.ptr(), end.ptr(), &queryFilter)))
+            {
+                result.mStatus = Status::FindPathOverPolygonsFailed;
+                return result;
+            }
+
+            version = locked->getVersion();
+        }
+
+        while (true)
+        {
+            const auto locked = navMeshCacheItem->lock();
+
+            dtStatus status = navMeshQuery.updateSlicedFindPath(sliceIterations, nullptr);
+            if (dtStatusInProgress(status))
+                continue;
+
+            // Tiles could be replaced while navmesh was unlocked between slices making visited polygons invalid
+            if (locked->getVersion() != version)
+            {
+                result.mStatus = findSmoothPath(query, *locked, halfExtents, stepSize, start, end,
+                    request.mIncludeFlags, request.mAreaCosts, mSettings, request.mEndTolerance,
+                    std::back_inserter(result.mPath));
+                return result;
+            }
+
+            int polygonPathSize = 0;
+            if (dtStatusSucceed(status))
+                status = navMeshQuery.finalizeSlicedFindPath(polygonPath.data(), &polygonPathSize,
+                    static_cast<int>(polygonPath.size()));
+
+            if (!dtStatusSucceed(status))
+            {
+                result.mStatus = Status::FindPathOverPolygonsFailed;
+                return result;
+            }
+
+            if (!dtStatusDetail(status, DT_PARTIAL_RESULT))
+                locked->cachePath(key, polygonPath, static_cast<std::size_t>(polygonPathSize));
+
+            result.mStatus = makeSmoothPathFromPolygonPath(locked->getImpl(), navMeshQuery, queryFilter, start, end,
+                stepSize, endRef, polygonPath, static_cast<std::size_t>(polygonPathSize), mSettings,
+                std::back_inserter(result.mPath));
+            return result;
+        }
+    }
+
+    void reportStats(const AsyncPathfinder::Stats& stats, unsigned int frameNumber, osg::Stats& out)
+    {
+        out.setAttribute(frameNumber, "NavMesh PathRequests", static_cast<double>(stats.mRequests));
+        out.setAttribute(frameNumber, "NavMesh PathProcessing", static_cast<double>(stats.mProcessing));
+    }
+}
@@ -0,0 +1,89 @@
+#ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_ASYNCPATHFINDER_H
+#define OPENMW_COMPONENTS_DETOURNAVIGATOR_ASYNCPATHFINDER_H
+
+#include "areatype.hpp"
+#include "flags.hpp"
+#include "guardednavmeshcacheitem.hpp"
+#include "pathresult.hpp"
+
+#include <osg/Vec3f>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace osg
+{
+    class Stats;
+}
+
+namespace DetourNavigator
+{
+    struct Settings;
+    struct PathfindingQuery;
+
+    struct PathRequest
+    {
+        std::weak_ptr<GuardedNavMeshCacheItem> mNavMeshCacheItem;
+        osg::Vec3f mAgentHalfExtents;
+        float mStepSize = 0;
+        osg::Vec3f mStart;
+        osg::Vec3f mEnd;
+        Flags mIncludeFlags = Flag_none;
+        AreaCosts mAreaCosts;
+        float mEndTolerance = 0;
+        PathCallback mCallback;
+    };
+
+    /**
+     * @brief Solves path requests in worker threads. Each thread owns its own dtNavMeshQuery and polygon path buffer
+     * reused for all requests. Polygon path search is done in slices with navmesh lock released between them to not
+     * block navmesh tiles update for a long time. Results are passed to the request callback from the worker thread.
+     */
+    class AsyncPathfinder
+    {
+    public:
+        struct Stats
+        {
+            std::size_t mRequests = 0;
+            std::size_t mProcessing = 0;
+        };
+
+        explicit AsyncPathfinder(const Settings& settings);
+        ~AsyncPathfinder();
+
+        /**
+         * @brief post adds request to the queue. Without worker threads request is solved and callback is called
+         * before return.
+         */
+        void post(PathRequest&& request);
+
+        /**
+         * @brief stop drops not started requests and waits for worker threads to finish current ones.
+         */
+        void stop();
+
+        Stats getStats() const;
+
+    private:
+        const Settings& mSettings;
+        bool mShouldStop = false;
+        mutable std::mutex mMutex;
+        std::condition_variable mHasRequest;
+        std::deque<PathRequest> mRequests;
+        std::atomic_size_t mProcessing {0};
+        std::vector<std::thread> mThreads;
+
+        void run() noexcept;
+
+        PathResult process(const PathRequest& request, PathfindingQuery& query) const;
+    };
+
+    void reportStats(const AsyncPathfinder::Stats& stats, unsigned int frameNumber, osg::Stats& out);
+}
+
+#endif
@@ -143,4 +143,10 @@ namespace DetourNavigator
             return 0;
         return ref;
     }
+
+    PathfindingQuery& getThreadPathfindingQuery()
+    {
+        thread_local PathfindingQuery query;
+        return query;
+    }
 }
@@ -6,6 +6,7 @@
 #include "settingsutils.hpp"
 #include "status.hpp"
 #include "areatype.hpp"
+#include "navmeshcacheitem.hpp"
 
 #include <DetourCommon.h>
 #include <DetourNavMesh.h>
@@ -252,54 +253,105 @@ namespace DetourNavigator
         return Status::Success;
     }
 
-    template <class OutputIterator>
-    Status findSmoothPath(const dtNavMesh& navMesh, const osg::Vec3f& halfExtents, const float stepSize,
-            const osg::Vec3f& start, const osg::Vec3f& end, const Flags includeFlags, const AreaCosts& areaCosts,
-            const Settings& settings, float endTolerance, OutputIterator out)
+    /// Search state which can be reused by consecutive path searches to avoid reallocating the dtNavMeshQuery node pool
+    /// and the polygon path buffer each time.
+    struct PathfindingQuery
     {
-        dtNavMeshQuery navMeshQuery;
-        if (!initNavMeshQuery(navMeshQuery, navMesh, settings.mDetour.mMaxNavMeshQueryNodes))
-            return Status::InitNavMeshQueryFailed;
+        dtNavMeshQuery mNavMeshQuery;
+        std::vector<dtPolyRef> mPolygonPath;
+    };
 
+    inline dtQueryFilter makeQueryFilter(const Flags includeFlags, const AreaCosts& areaCosts)
+    {
         dtQueryFilter queryFilter;
         queryFilter.setIncludeFlags(includeFlags);
         queryFilter.setAreaCost(AreaType_water, areaCosts.mWater);
         queryFilter.setAreaCost(AreaType_door, areaCosts.mDoor);
         queryFilter.setAreaCost(AreaType_pathgrid, areaCosts.mPathgrid);
         queryFilter.setAreaCost(AreaType_ground, areaCosts.mGround);
+        return queryFilter;
+    }
 
+    inline Status findPathEndPolygons(const dtNavMeshQuery& navMeshQuery, const dtQueryFilter& queryFilter,
+        const osg::Vec3f& halfExtents, const osg::Vec3f& start, const osg::Vec3f& end, float endTolerance,
+        dtPolyRef& startRef, dtPolyRef& endRef)
+    {
         constexpr float polyDistanceFactor = 4;
         const osg::Vec3f polyHalfExtents = halfExtents * polyDistanceFactor;
 
-        const dtPolyRef startRef = findNearestPoly(navMeshQuery, queryFilter, start, polyHalfExtents);
+        startRef = findNearestPoly(navMeshQuery, queryFilter, start, polyHalfExtents);
         if (startRef == 0)
             return Status::StartPolygonNotFound;
 
-        const dtPolyRef endRef = findNearestPoly(navMeshQuery, queryFilter, end,
+        endRef = findNearestPoly(navMeshQuery, queryFilter, end,
             polyHalfExtents + osg::Vec3f(endTolerance, endTolerance, endTolerance));
         if (endRef == 0)
             return Status::EndPolygonNotFound;
 
-        std::vector<dtPolyRef> polygonPath(settings.mDetour.mMaxPolygonPathSize);
-        const auto polygonPathSize = findPath(navMeshQuery, startRef, endRef, start, end, queryFilter,
-                                              polygonPath.data(), polygonPath.size());
-
-        if (!polygonPathSize.has_value())
-            return Status::FindPathOverPolygonsFailed;
+        return Status::Success;
+    }
 
-        if (*polygonPathSize == 0)
+    template <class OutputIterator>
+    Status makeSmoothPathFromPolygonPath(const dtNavMesh& navMesh, const dtNavMeshQuery& navMeshQuery,
+        const dtQueryFilter& queryFilter, const osg::Vec3f& start, const osg::Vec3f& end, const float stepSize,
+        const dtPolyRef endRef, std::vector<dtPolyRef>& polygonPath, std::size_t polygonPathSize,
+        const Settings& settings, OutputIterator out)
+    {
+        if (polygonPathSize == 0)
             return Status::Success;
 
-        const bool partialPath = polygonPath[*polygonPathSize - 1] != endRef;
+        const bool partialPath = polygonPath[polygonPathSize - 1] != endRef;
         auto outTransform = OutputTransformIterator<OutputIterator>(out, settings.mRecast);
         const Status smoothStatus = makeSmoothPath(navMesh, navMeshQuery, queryFilter, start, end, stepSize,
-            polygonPath, *polygonPathSize, settings.mDetour.mMaxSmoothPathSize, outTransform);
+            polygonPath, polygonPathSize, settings.mDetour.mMaxSmoothPathSize, outTransform);
 
         if (smoothStatus != Status::Success)
             return smoothStatus;
 
         return partialPath ? Status::PartialPath : Status::Success;
     }
+
+    template <class OutputIterator>
+    Status findSmoothPath(PathfindingQuery& query, NavMeshCacheItem& navMeshCacheItem, const osg::Vec3f& halfExtents,
+            const float stepSize, const osg::Vec3f& start, const osg::Vec3f& end, const Flags includeFlags,
+            const AreaCosts& areaCosts, const Settings& settings, float endTolerance, OutputIterator out)
+    {
+        const dtNavMesh& navMesh = navMeshCacheItem.getImpl();
+        dtNavMeshQuery& navMeshQuery = query.mNavMeshQuery;
+        if (!initNavMeshQuery(navMeshQuery, navMesh, settings.mDetour.mMaxNavMeshQueryNodes))
+            return Status::InitNavMeshQueryFailed;
+
+        const dtQueryFilter queryFilter = makeQueryFilter(includeFlags, areaCosts);
+
+        dtPolyRef startRef = 0;
+        dtPolyRef endRef = 0;
+        const Status endsStatus = findPathEndPolygons(navMeshQuery, queryFilter, halfExtents, start, end, endTolerance,
+            startRef, endRef);
+        if (endsStatus != Status::Success)
+            return endsStatus;
+
+        std::vector<dtPolyRef>& polygonPath = query.mPolygonPath;
+        polygonPath.resize(settings.mDetour.mMaxPolygonPathSize);
+        const PathCacheKey key {startRef, endRef, includeFlags, areaCosts};
+        auto polygonPathSize = navMeshCacheItem.getCachedPath(key, polygonPath);
+
+        if (!polygonPathSize.has_value())
+        {
+            polygonPathSize = findPath(navMeshQuery, startRef, endRef, start, end, queryFilter,
+                                       polygonPath.data(), polygonPath.size());
+
+            if (!polygonPathSize.has_value())
+                return Status::FindPathOverPolygonsFailed;
+
+            navMeshCacheItem.cachePath(key, polygonPath, *polygonPathSize);
+        }
+
+        return makeSmoothPathFromPolygonPath(navMesh, navMeshQuery, queryFilter, start, end, stepSize, endRef,
+            polygonPath, *polygonPathSize, settings, out);
+    }
+
+    /// @return search state owned by the calling thread
+    PathfindingQuery& getThreadPathfindingQuery();
 }
 
 #endif
@@ -71,7 +71,7 @@ namespace DetourNavigator
             std::vector<std::byte> input = serialize(mSettings.mRecast, mAgentBounds, *recastMesh, objects);
             const std::optional<NavMeshTileInfo> info = consumer->find(mWorldspace, mTilePosition, input);
 
-            if (info.has_value() && info->mVersion == navMeshFormatVersion)
+            if (info.has_value() && isSupportedNavMeshFormatVersion(info->mVersion))
             {
                 consumer->identity(mWorldspace, mTilePosition, info->mTileId);
                 ignore.mConsumer = nullptr;
@@ -7,6 +7,9 @@
 #include "waitconditiontype.hpp"
 #include "heightfieldshape.hpp"
 #include "objecttransform.hpp"
+#include "areatype.hpp"
+#include "flags.hpp"
+#include "pathresult.hpp"
 
 #include <components/resource/bulletshape.hpp>
 
@@ -199,6 +202,21 @@ namespace DetourNavigator
          */
         virtual std::map<AgentBounds, SharedNavMeshCacheItem> getNavMeshes() const = 0;
 
+        /**
+         * @brief findPathAsync queues path search to be done in background.
+         * @param agentBounds allows to find navmesh for given actor.
+         * @param start path from given point.
+         * @param end path at given point.
+         * @param includeFlags setup allowed surfaces for actor to walk.
+         * @param endTolerance defines maximum allowed distance to end path point in addition to agentHalfExtents.
+         * @param callback is called with found path or thrown exception from a background thread or immediately when
+         * there is no navmesh or async pathfinder threads are disabled. Not called for requests dropped on navigator
+         * destruction.
+         */
+        virtual void findPathAsync(const AgentBounds& agentBounds, float stepSize, const osg::Vec3f& start,
+            const osg::Vec3f& end, Flags includeFlags, const AreaCosts& areaCosts, float endTolerance,
+            PathCallback&& callback) = 0;
+
         virtual const Settings& getSettings() const = 0;
 
         virtual void reportStats(unsigned int frameNumber, osg::Stats& stats) const = 0;
@@ -11,6 +11,7 @@ namespace DetourNavigator
     NavigatorImpl::NavigatorImpl(const Settings& settings, std::unique_ptr<NavMeshDb>&& db)
         : mSettings(settings)
         , mNavMeshManager(mSettings, std::move(db))
+        , mPathfinder(mSettings)
         , mUpdatesEnabled(true)
     {
     }
@@ -187,6 +188,29 @@ namespace DetourNavigator
         return mNavMeshManager.getNavMeshes();
     }
 
+    void NavigatorImpl::findPathAsync(const AgentBounds& agentBounds, float stepSize, const osg::Vec3f& start,
+        const osg::Vec3f& end, Flags includeFlags, const AreaCosts& areaCosts, float endTolerance,
+        PathCallback&& callback)
+    {
+        SharedNavMeshCacheItem navMesh = mNavMeshManager.getNavMesh(agentBounds);
+        if (navMesh == nullptr)
+        {
+            callback(PathResult {Status::NavMeshNotFound, {}}, nullptr);
+            return;
+        }
+        PathRequest request;
+        request.mNavMeshCacheItem = std::move(navMesh);
+        request.mAgentHalfExtents = agentBounds.mHalfExtents;
+        request.mStepSize = stepSize;
+        request.mStart = start;
+        request.mEnd = end;
+        request.mIncludeFlags = includeFlags;
+        request.mAreaCosts = areaCosts;
+        request.mEndTolerance = endTolerance;
+        request.mCallback = std::move(callback);
+        mPathfinder.post(std::move(request));
+    }
+
     const Settings& NavigatorImpl::getSettings() const
     {
         return mSettings;
@@ -195,6 +219,17 @@ namespace DetourNavigator
     void NavigatorImpl::reportStats(unsigned int frameNumber, osg::Stats& stats) const
     {
         mNavMeshManager.reportStats(frameNumber, stats);
+        DetourNavigator::reportStats(mPathfinder.getStats(), frameNumber, stats);
+
+        PathCache::Stats pathCacheStats;
+        for (const auto& [agentBounds, navMesh] : mNavMeshManager.getNavMeshes())
+        {
+            const PathCache::Stats navMeshStats = navMesh->lockConst()->getPathCacheStats();
+            pathCacheStats.mSize += navMeshStats.mSize;
+            pathCacheStats.mHitCount += navMeshStats.mHitCount;
+            pathCacheStats.mGetCount += navMeshStats.mGetCount;
+        }
+        DetourNavigator::reportStats(pathCacheStats, frameNumber, stats);
     }
 
     RecastMeshTiles NavigatorImpl::getRecastMeshTiles() const
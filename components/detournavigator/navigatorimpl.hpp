@@ -3,6 +3,7 @@
 
 #include "navigator.hpp"
 #include "navmeshmanager.hpp"
+#include "asyncpathfinder.hpp"
 
 #include <set>
 #include <memory>
@@ -60,6 +61,10 @@ namespace DetourNavigator
 
         std::map<AgentBounds, SharedNavMeshCacheItem> getNavMeshes() const override;
 
+        void findPathAsync(const AgentBounds& agentBounds, float stepSize, const osg::Vec3f& start,
+            const osg::Vec3f& end, Flags includeFlags, const AreaCosts& areaCosts, float endTolerance,
+            PathCallback&& callback) override;
+
         const Settings& getSettings() const override;
 
         void reportStats(unsigned int frameNumber, osg::Stats& stats) const override;
@@ -71,6 +76,7 @@ namespace DetourNavigator
     private:
         Settings mSettings;
         NavMeshManager mNavMeshManager;
+        AsyncPathfinder mPathfinder;
         bool mUpdatesEnabled;
         std::optional<TilePosition> mLastPlayerPosition;
         std::map<AgentBounds, std::size_t> mAgents;
@@ -91,6 +91,13 @@ namespace DetourNavigator
             return {};
         }
 
+        void findPathAsync(const AgentBounds& /*agentBounds*/, float /*stepSize*/, const osg::Vec3f& /*start*/,
+            const osg::Vec3f& /*end*/, Flags /*includeFlags*/, const AreaCosts& /*areaCosts*/,
+            float /*endTolerance*/, PathCallback&& callback) override
+        {
+            callback(PathResult {Status::NavMeshNotFound, {}}, nullptr);
+        }
+
         const Settings& getSettings() const override
         {
             return mDefaultSettings;
@@ -3,8 +3,27 @@
 #include "navigator.hpp"
 #include "raycast.hpp"
 
+#include <memory>
+
 namespace DetourNavigator
 {
+    std::future<PathResult> findPathAsync(Navigator& navigator, const AgentBounds& agentBounds, float stepSize,
+        const osg::Vec3f& start, const osg::Vec3f& end, Flags includeFlags, const AreaCosts& areaCosts,
+        float endTolerance)
+    {
+        auto promise = std::make_shared<std::promise<PathResult>>();
+        std::future<PathResult> result = promise->get_future();
+        navigator.findPathAsync(agentBounds, stepSize, start, end, includeFlags, areaCosts, endTolerance,
+            [promise] (PathResult&& value, std::exception_ptr error)
+            {
+                if (error != nullptr)
+                    promise->set_exception(error);
+                else
+                    promise->set_value(std::move(value));
+            });
+        return result;
+    }
+
     std::optional<osg::Vec3f> findRandomPointAroundCircle(const Navigator& navigator, const AgentBounds& agentBounds,
         const osg::Vec3f& start, const float maxRadius, const Flags includeFlags, float(*prng)())
     {
@@ -9,6 +9,7 @@
 
 #include <components/misc/guarded.hpp>
 
+#include <future>
 #include <optional>
 
 namespace DetourNavigator
@@ -40,11 +41,21 @@ namespace DetourNavigator
         if (navMesh == nullptr)
             return Status::NavMeshNotFound;
         const auto settings = navigator.getSettings();
-        return findSmoothPath(navMesh->lockConst()->getImpl(), toNavMeshCoordinates(settings.mRecast, agentBounds.mHalfExtents),
+        return findSmoothPath(getThreadPathfindingQuery(), *navMesh->lock(),
+            toNavMeshCoordinates(settings.mRecast, agentBounds.mHalfExtents),
             toNavMeshCoordinates(settings.mRecast, stepSize), toNavMeshCoordinates(settings.mRecast, start),
             toNavMeshCoordinates(settings.mRecast, end), includeFlags, areaCosts, settings, endTolerance, out);
     }
 
+    /**
+     * @brief findPathAsync queues path search to be done in background by Navigator::findPathAsync.
+     * @return future to get found path. Throws std::future_error on get if request is dropped and rethrows an
+     * exception thrown by the search.
+     */
+    std::future<PathResult> findPathAsync(Navigator& navigator, const AgentBounds& agentBounds, float stepSize,
+        const osg::Vec3f& start, const osg::Vec3f& end, Flags includeFlags, const AreaCosts& areaCosts,
+        float endTolerance);
+
     /**
      * @brief findRandomPointAroundCircle returns random location on navmesh within the reach of specified location.
      * @param agentBounds allows to find navmesh for given actor.
@@ -8,6 +8,7 @@
 
 #include <DetourNavMesh.h>
 
+#include <algorithm>
 #include <ostream>
 
 namespace
@@ -136,4 +137,47 @@ namespace DetourNavigator
     {
         return mEmptyTiles.find(position) != mEmptyTiles.end();
     }
+
+    std::optional<Version> NavMeshCacheItem::getTileVersion(const TilePosition& position) const
+    {
+        const auto it = mUsedTiles.find(position);
+        if (it == mUsedTiles.end())
+            return std::nullopt;
+        return it->second.mVersion;
+    }
+
+    std::optional<std::size_t> NavMeshCacheItem::getCachedPath(const PathCacheKey& key, std::vector<dtPolyRef>& path)
+    {
+        const std::vector<dtPolyRef>* const cached = mPathCache.get(key,
+            [&] (const TilePosition& position) { return getTileVersion(position); });
+        if (cached == nullptr || cached->size() > path.size())
+            return std::nullopt;
+        std::copy(cached->begin(), cached->end(), path.begin());
+        return cached->size();
+    }
+
+    void NavMeshCacheItem::cachePath(const PathCacheKey& key, const std::vector<dtPolyRef>& path, std::size_t pathSize)
+    {
+        if (pathSize == 0)
+            return;
+        PathCache::TileVersions tiles;
+        for (std::size_t i = 0; i < pathSize; ++i)
+        {
+            const dtMeshTile* tile = nullptr;
+            const dtPoly* poly = nullptr;
+            if (dtStatusFailed(mImpl->getTileAndPolyByRef(path[i], &tile, &poly)))
+                return;
+            const TilePosition position(tile->header->x, tile->header->y);
+            if (!tiles.empty() && tiles.back().first == position)
+                continue;
+            const auto version = getTileVersion(position);
+            if (!version.has_value())
+                return;
+            tiles.emplace_back(position, *version);
+        }
+        std::sort(tiles.begin(), tiles.end(), [] (const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+        tiles.erase(std::unique(tiles.begin(), tiles.end(),
+            [] (const auto& lhs, const auto& rhs) { return lhs.first == rhs.first; }), tiles.end());
+        mPathCache.set(key, std::vector<dtPolyRef>(path.begin(), path.begin() + pathSize), std::move(tiles));
+    }
 }
@@ -6,9 +6,11 @@
 #include "navmeshtilescache.hpp"
 #include "navmeshdata.hpp"
 #include "version.hpp"
+#include "pathcache.hpp"
 
 #include <map>
 #include <iosfwd>
+#include <optional>
 #include <set>
 
 struct dtMeshTile;
@@ -103,9 +105,10 @@ namespace DetourNavigator
     class NavMeshCacheItem
     {
     public:
-        NavMeshCacheItem(const NavMeshPtr& impl, std::size_t generation)
+        NavMeshCacheItem(const NavMeshPtr& impl, std::size_t generation, std::size_t maxPathCacheSize = 0)
             : mImpl(impl)
             , mVersion {generation, 0}
+            , mPathCache(maxPathCacheSize)
         {
         }
 
@@ -125,6 +128,18 @@ namespace DetourNavigator
 
         bool isEmptyTile(const TilePosition& position) const;
 
+        std::optional<Version> getTileVersion(const TilePosition& position) const;
+
+        /**
+         * @brief getCachedPath copies polygon path found before for the same key into path if it is still valid.
+         * @return size of the copied path or empty optional if there is no such path.
+         */
+        std::optional<std::size_t> getCachedPath(const PathCacheKey& key, std::vector<dtPolyRef>& path);
+
+        void cachePath(const PathCacheKey& key, const std::vector<dtPolyRef>& path, std::size_t pathSize);
+
+        PathCache::Stats getPathCacheStats() const { return mPathCache.getStats(); }
+
         template <class Function>
         void forEachUsedTile(Function&& function) const
         {
@@ -145,6 +160,7 @@ namespace DetourNavigator
         Version mVersion;
         std::map<TilePosition, Tile> mUsedTiles;
         std::set<TilePosition> mEmptyTiles;
+        PathCache mPathCache;
     };
 }
 
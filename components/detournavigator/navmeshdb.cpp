@@ -10,8 +10,12 @@
 
 #include <sqlite3.h>
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
+#include <string>
 #include <string_view>
+#include <tuple>
 #include <vector>
 
 namespace DetourNavigator
@@ -51,6 +55,24 @@ namespace DetourNavigator
             COMMIT;
         )";
 
+        // Each migration upgrades database schema from the version equal to its index in the array
+        constexpr const char* const migrations[] = {
+            R"(
+                BEGIN TRANSACTION;
+
+                ALTER TABLE tiles ADD COLUMN dictionary_id INTEGER NOT NULL DEFAULT 0;
+
+                CREATE TABLE IF NOT EXISTS dictionaries (
+                    dictionary_id INTEGER PRIMARY KEY,
+                    data BLOB NOT NULL
+                );
+
+                PRAGMA user_version = 1;
+
+                COMMIT;
+            )",
+        };
+
         constexpr std::string_view getMaxTileIdQuery = R"(
             SELECT max(tile_id) FROM tiles
         )";
@@ -65,7 +87,7 @@ namespace DetourNavigator
         )";
 
         constexpr std::string_view getTileDataQuery = R"(
-            SELECT tile_id, version, data
+            SELECT tile_id, version, dictionary_id, data
               FROM tiles
              WHERE worldspace = :worldspace
                AND tile_position_x = :tile_position_x
@@ -74,18 +96,40 @@ namespace DetourNavigator
         )";
 
         constexpr std::string_view insertTileQuery = R"(
-            INSERT INTO tiles ( tile_id,  worldspace,  version,  tile_position_x,  tile_position_y,  input,  data)
-                   VALUES     (:tile_id, :worldspace, :version, :tile_position_x, :tile_position_y, :input, :data)
+            INSERT INTO tiles ( tile_id,  worldspace,  version,  tile_position_x,  tile_position_y,  input,  dictionary_id,  data)
+                   VALUES     (:tile_id, :worldspace, :version, :tile_position_x, :tile_position_y, :input, :dictionary_id, :data)
         )";
 
         constexpr std::string_view updateTileQuery = R"(
             UPDATE tiles
                SET version = :version,
+                   dictionary_id = :dictionary_id,
                    data = :data,
                    revision = revision + 1
              WHERE tile_id = :tile_id
         )";
 
+        constexpr std::string_view updateTileDataQuery = R"(
+            UPDATE tiles
+               SET dictionary_id = :dictionary_id,
+                   data = :data
+             WHERE tile_id = :tile_id
+        )";
+
+        constexpr std::string_view getTilesSampleQuery = R"(
+            SELECT dictionary_id, data
+              FROM tiles
+             ORDER BY random()
+             LIMIT :limit
+        )";
+
+        constexpr std::string_view getTilesWithOtherDictionaryQuery = R"(
+            SELECT tile_id, dictionary_id, data
+              FROM tiles
+             WHERE dictionary_id != :dictionary_id
+             LIMIT :limit
+        )";
+
         constexpr std::string_view deleteTilesAtQuery = R"(
             DELETE FROM tiles
              WHERE worldspace = :worldspace
@@ -128,6 +172,21 @@ namespace DetourNavigator
                    VALUES      (:shape_id, :name, :type, :hash)
         )";
 
+        constexpr std::string_view getMaxDictionaryIdQuery = R"(
+            SELECT max(dictionary_id) FROM dictionaries
+        )";
+
+        constexpr std::string_view getDictionaryQuery = R"(
+            SELECT data
+              FROM dictionaries
+             WHERE dictionary_id = :dictionary_id
+        )";
+
+        constexpr std::string_view insertDictionaryQuery = R"(
+            INSERT INTO dictionaries ( dictionary_id,  data)
+                   VALUES            (:dictionary_id, :data)
+        )";
+
         constexpr std::string_view vacuumQuery = R"(
             VACUUM;
         )";
@@ -138,6 +197,32 @@ namespace DetourNavigator
             static void bind(sqlite3&, sqlite3_stmt&) {}
         };
 
+        struct GetUserVersion
+        {
+            static std::string_view text() noexcept { return "pragma user_version;"; }
+            static void bind(sqlite3&, sqlite3_stmt&) {}
+        };
+
+        Sqlite3::Db makeNavMeshDb(std::string_view path)
+        {
+            Sqlite3::Db db = Sqlite3::makeDb(path, schema);
+            Sqlite3::Statement<GetUserVersion> statement(*db);
+            int version = 0;
+            request(*db, statement, &version, 1);
+            for (int i = std::max(version, 0); i < static_cast<int>(std::size(migrations)); ++i)
+            {
+                Log(Debug::Verbose) << "Migrating navmeshdb \"" << path << "\" from version " << i << " to " << i + 1;
+                if (const int ec = sqlite3_exec(db.get(), migrations[i], nullptr, nullptr, nullptr); ec != SQLITE_OK)
+                {
+                    const std::string message(sqlite3_errmsg(db.get()));
+                    sqlite3_exec(db.get(), "ROLLBACK", nullptr, nullptr, nullptr);
+                    throw std::runtime_error("Failed to migrate navmeshdb schema to version " + std::to_string(i + 1)
+                                             + ": " + message);
+                }
+            }
+            return db;
+        }
+
         std::uint64_t getPageSize(sqlite3& db)
         {
             Sqlite3::Statement<GetPageSize> statement(db);
@@ -146,6 +231,16 @@ namespace DetourNavigator
             return value;
         }
 
+        void setWriteAheadLogJournalMode(sqlite3& db)
+        {
+            // WAL allows to commit a transaction without syncing the database file and with synchronous = NORMAL
+            // without syncing at all. In case of a crash only the last transactions may be lost which is fine for
+            // a cache.
+            constexpr const char query[] = "pragma journal_mode = wal; pragma synchronous = normal;";
+            if (const int ec = sqlite3_exec(&db, query, nullptr, nullptr, nullptr); ec != SQLITE_OK)
+                throw std::runtime_error("Failed set journal mode: " + std::string(sqlite3_errmsg(&db)));
+        }
+
         void setMaxPageCount(sqlite3& db, std::uint64_t value)
         {
             const auto query = Misc::StringUtils::format("pragma max_page_count = %lu;", value);
@@ -165,24 +260,33 @@ namespace DetourNavigator
     }
 
     NavMeshDb::NavMeshDb(std::string_view path, std::uint64_t maxFileSize)
-        : mDb(Sqlite3::makeDb(path, schema))
+        : mDb(makeNavMeshDb(path))
         , mGetMaxTileId(*mDb, DbQueries::GetMaxTileId {})
         , mFindTile(*mDb, DbQueries::FindTile {})
         , mGetTileData(*mDb, DbQueries::GetTileData {})
         , mInsertTile(*mDb, DbQueries::InsertTile {})
         , mUpdateTile(*mDb, DbQueries::UpdateTile {})
+        , mUpdateTileData(*mDb, DbQueries::UpdateTileData {})
+        , mGetTilesSample(*mDb, DbQueries::GetTilesSample {})
+        , mGetTilesWithOtherDictionary(*mDb, DbQueries::GetTilesWithOtherDictionary {})
         , mDeleteTilesAt(*mDb, DbQueries::DeleteTilesAt {})
         , mDeleteTilesAtExcept(*mDb, DbQueries::DeleteTilesAtExcept {})
         , mDeleteTilesOutsideRange(*mDb, DbQueries::DeleteTilesOutsideRange {})
         , mGetMaxShapeId(*mDb, DbQueries::GetMaxShapeId {})
         , mFindShapeId(*mDb, DbQueries::FindShapeId {})
         , mInsertShape(*mDb, DbQueries::InsertShape {})
+        , mGetMaxDictionaryId(*mDb, DbQueries::GetMaxDictionaryId {})
+        , mGetDictionary(*mDb, DbQueries::GetDictionary {})
+        , mInsertDictionary(*mDb, DbQueries::InsertDictionary {})
         , mVacuum(*mDb, DbQueries::Vacuum {})
     {
         const std::uint64_t dbPageSize = getPageSize(*mDb);
         if (dbPageSize == 0)
             throw std::runtime_error("NavMeshDb page size is zero");
         setMaxPageCount(*mDb, maxFileSize / dbPageSize + static_cast<std::uint64_t>((maxFileSize % dbPageSize) != 0));
+        setWriteAheadLogJournalMode(*mDb);
+        request(*mDb, mGetMaxDictionaryId, &mDictionaryId, 1);
+        getDictionary(mDictionaryId);
     }
 
     Sqlite3::Transaction NavMeshDb::startTransaction(Sqlite3::TransactionMode mode)
@@ -212,26 +316,29 @@ namespace DetourNavigator
         const TilePosition& tilePosition, const std::vector<std::byte>& input)
     {
         TileData result;
-        auto row = std::tie(result.mTileId, result.mVersion, result.mData);
+        DictionaryId dictionaryId {0};
+        auto row = std::tie(result.mTileId, result.mVersion, dictionaryId, result.mData);
         const std::vector<std::byte> compressedInput = Misc::compress(input);
         if (&row == request(*mDb, mGetTileData, &row, 1, worldspace, tilePosition, compressedInput))
             return {};
-        result.mData = Misc::decompress(result.mData);
+        result.mData = Misc::decompress(result.mData, getDictionary(dictionaryId));
         return result;
     }
 
     int NavMeshDb::insertTile(TileId tileId, std::string_view worldspace, const TilePosition& tilePosition,
         TileVersion version, const std::vector<std::byte>& input, const std::vector<std::byte>& data)
     {
+        // Input is a part of the key so it's always compressed without dictionary to keep lookups stable
         const std::vector<std::byte> compressedInput = Misc::compress(input);
-        const std::vector<std::byte> compressedData = Misc::compress(data);
-        return execute(*mDb, mInsertTile, tileId, worldspace, tilePosition, version, compressedInput, compressedData);
+        const std::vector<std::byte> compressedData = Misc::compress(data, getDictionary(mDictionaryId));
+        return execute(*mDb, mInsertTile, tileId, worldspace, tilePosition, version, compressedInput,
+                       mDictionaryId, compressedData);
     }
 
     int NavMeshDb::updateTile(TileId tileId, TileVersion version, const std::vector<std::byte>& data)
     {
-        const std::vector<std::byte> compressedData = Misc::compress(data);
-        return execute(*mDb, mUpdateTile, tileId, version, compressedData);
+        const std::vector<std::byte> compressedData = Misc::compress(data, getDictionary(mDictionaryId));
+        return execute(*mDb, mUpdateTile, tileId, version, mDictionaryId, compressedData);
     }
 
     int NavMeshDb::deleteTilesAt(std::string_view worldspace, const TilePosition& tilePosition)
@@ -271,11 +378,65 @@ namespace DetourNavigator
         return execute(*mDb, mInsertShape, shapeId, name, type, hash);
     }
 
+    DictionaryId NavMeshDb::makeDictionary(std::size_t maxSamples)
+    {
+        std::vector<std::tuple<DictionaryId, std::vector<std::byte>>> tiles;
+        request(*mDb, mGetTilesSample, std::back_inserter(tiles), maxSamples, maxSamples);
+        std::vector<std::vector<std::byte>> samples;
+        samples.reserve(tiles.size());
+        for (const auto& [dictionaryId, data] : tiles)
+            samples.push_back(Misc::decompress(data, getDictionary(dictionaryId)));
+        std::vector<std::byte> dictionary = Misc::makeCompressionDictionary(samples);
+        if (dictionary.empty())
+            return mDictionaryId;
+        DictionaryId dictionaryId {0};
+        request(*mDb, mGetMaxDictionaryId, &dictionaryId, 1);
+        ++dictionaryId;
+        execute(*mDb, mInsertDictionary, dictionaryId, dictionary);
+        mDictionaries.emplace(dictionaryId, std::move(dictionary));
+        mDictionaryId = dictionaryId;
+        return mDictionaryId;
+    }
+
+    std::size_t NavMeshDb::recompressTiles()
+    {
+        constexpr std::size_t batchSize = 1024;
+        const std::vector<std::byte>& dictionary = getDictionary(mDictionaryId);
+        std::size_t result = 0;
+        std::vector<std::tuple<TileId, DictionaryId, std::vector<std::byte>>> tiles;
+        while (true)
+        {
+            tiles.clear();
+            request(*mDb, mGetTilesWithOtherDictionary, std::back_inserter(tiles), batchSize, mDictionaryId, batchSize);
+            if (tiles.empty())
+                break;
+            for (const auto& [tileId, dictionaryId, data] : tiles)
+            {
+                const std::vector<std::byte> compressedData = Misc::compress(
+                    Misc::decompress(data, getDictionary(dictionaryId)), dictionary);
+                execute(*mDb, mUpdateTileData, tileId, mDictionaryId, compressedData);
+            }
+            result += tiles.size();
+        }
+        return result;
+    }
+
     void NavMeshDb::vacuum()
     {
         execute(*mDb, mVacuum);
     }
 
+    const std::vector<std::byte>& NavMeshDb::getDictionary(DictionaryId dictionaryId)
+    {
+        const auto it = mDictionaries.find(dictionaryId);
+        if (it != mDictionaries.end())
+            return it->second;
+        std::vector<std::byte> dictionary;
+        if (dictionaryId != 0 && &dictionary == request(*mDb, mGetDictionary, &dictionary, 1, dictionaryId))
+            throw std::runtime_error("Compression dictionary is not found: " + std::to_string(static_cast<std::int64_t>(dictionaryId)));
+        return mDictionaries.emplace(dictionaryId, std::move(dictionary)).first->second;
+    }
+
     namespace DbQueries
     {
         std::string_view GetMaxTileId::text() noexcept
@@ -318,7 +479,7 @@ namespace DetourNavigator
 
         void InsertTile::bind(sqlite3& db, sqlite3_stmt& statement, TileId tileId, std::string_view worldspace,
             const TilePosition& tilePosition, TileVersion version, const std::vector<std::byte>& input,
-            const std::vector<std::byte>& data)
+            DictionaryId dictionaryId, const std::vector<std::byte>& data)
         {
             Sqlite3::bindParameter(db, statement, ":tile_id", tileId);
             Sqlite3::bindParameter(db, statement, ":worldspace", worldspace);
@@ -326,6 +487,7 @@ namespace DetourNavigator
             Sqlite3::bindParameter(db, statement, ":tile_position_y", tilePosition.y());
             Sqlite3::bindParameter(db, statement, ":version", version);
             Sqlite3::bindParameter(db, statement, ":input", input);
+            Sqlite3::bindParameter(db, statement, ":dictionary_id", dictionaryId);
             Sqlite3::bindParameter(db, statement, ":data", data);
         }
 
@@ -335,13 +497,49 @@ namespace DetourNavigator
         }
 
         void UpdateTile::bind(sqlite3& db, sqlite3_stmt& statement, TileId tileId, TileVersion version,
-            const std::vector<std::byte>& data)
+            DictionaryId dictionaryId, const std::vector<std::byte>& data)
         {
             Sqlite3::bindParameter(db, statement, ":tile_id", tileId);
             Sqlite3::bindParameter(db, statement, ":version", version);
+            Sqlite3::bindParameter(db, statement, ":dictionary_id", dictionaryId);
             Sqlite3::bindParameter(db, statement, ":data", data);
         }
 
+        std::string_view UpdateTileData::text() noexcept
+        {
+            return updateTileDataQuery;
+        }
+
+        void UpdateTileData::bind(sqlite3& db, sqlite3_stmt& statement, TileId tileId, DictionaryId dictionaryId,
+            const std::vector<std::byte>& data)
+        {
+            Sqlite3::bindParameter(db, statement, ":tile_id", tileId);
+            Sqlite3::bindParameter(db, statement, ":dictionary_id", dictionaryId);
+            Sqlite3::bindParameter(db, statement, ":data", data);
+        }
+
+        std::string_view GetTilesSample::text() noexcept
+        {
+            return getTilesSampleQuery;
+        }
+
+        void GetTilesSample::bind(sqlite3& db, sqlite3_stmt& statement, std::size_t limit)
+        {
+            Sqlite3::bindParameter(db, statement, ":limit", static_cast<std::int64_t>(limit));
+        }
+
+        std::string_view GetTilesWithOtherDictionary::text() noexcept
+        {
+            return getTilesWithOtherDictionaryQuery;
+        }
+
+        void GetTilesWithOtherDictionary::bind(sqlite3& db, sqlite3_stmt& statement, DictionaryId dictionaryId,
+            std::size_t limit)
+        {
+            Sqlite3::bindParameter(db, statement, ":dictionary_id", dictionaryId);
+            Sqlite3::bindParameter(db, statement, ":limit", static_cast<std::int64_t>(limit));
+        }
+
         std::string_view DeleteTilesAt::text() noexcept
         {
             return deleteTilesAtQuery;
@@ -416,6 +614,33 @@ namespace DetourNavigator
             Sqlite3::bindParameter(db, statement, ":hash", hash);
         }
 
+        std::string_view GetMaxDictionaryId::text() noexcept
+        {
+            return getMaxDictionaryIdQuery;
+        }
+
+        std::string_view GetDictionary::text() noexcept
+        {
+            return getDictionaryQuery;
+        }
+
+        void GetDictionary::bind(sqlite3& db, sqlite3_stmt& statement, DictionaryId dictionaryId)
+        {
+            Sqlite3::bindParameter(db, statement, ":dictionary_id", dictionaryId);
+        }
+
+        std::string_view InsertDictionary::text() noexcept
+        {
+            return insertDictionaryQuery;
+        }
+
+        void InsertDictionary::bind(sqlite3& db, sqlite3_stmt& statement, DictionaryId dictionaryId,
+            const std::vector<std::byte>& data)
+        {
+            Sqlite3::bindParameter(db, statement, ":dictionary_id", dictionaryId);
+            Sqlite3::bindParameter(db, statement, ":data", data);
+        }
+
         std::string_view Vacuum::text() noexcept
         {
             return vacuumQuery;
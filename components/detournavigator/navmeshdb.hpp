@@ -14,6 +14,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <map>
 #include <optional>
 #include <stdexcept>
 #include <string_view>
@@ -31,6 +32,7 @@ namespace DetourNavigator
     using TileRevision = Misc::StrongTypedef<std::int64_t, struct TileRevisionTag>;
     using TileVersion = Misc::StrongTypedef<std::int64_t, struct TileVersionTag>;
     using ShapeId = Misc::StrongTypedef<std::int64_t, struct ShapeIdTag>;
+    using DictionaryId = Misc::StrongTypedef<std::int64_t, struct DictionaryIdTag>;
 
     struct Tile
     {
@@ -80,16 +82,35 @@ namespace DetourNavigator
             static std::string_view text() noexcept;
             static void bind(sqlite3& db, sqlite3_stmt& statement, TileId tileId, std::string_view worldspace,
                 const TilePosition& tilePosition, TileVersion version, const std::vector<std::byte>& input,
-                const std::vector<std::byte>& data);
+                DictionaryId dictionaryId, const std::vector<std::byte>& data);
         };
 
         struct UpdateTile
         {
             static std::string_view text() noexcept;
             static void bind(sqlite3& db, sqlite3_stmt& statement, TileId tileId, TileVersion version,
+                DictionaryId dictionaryId, const std::vector<std::byte>& data);
+        };
+
+        struct UpdateTileData
+        {
+            static std::string_view text() noexcept;
+            static void bind(sqlite3& db, sqlite3_stmt& statement, TileId tileId, DictionaryId dictionaryId,
                 const std::vector<std::byte>& data);
         };
 
+        struct GetTilesSample
+        {
+            static std::string_view text() noexcept;
+            static void bind(sqlite3& db, sqlite3_stmt& statement, std::size_t limit);
+        };
+
+        struct GetTilesWithOtherDictionary
+        {
+            static std::string_view text() noexcept;
+            static void bind(sqlite3& db, sqlite3_stmt& statement, DictionaryId dictionaryId, std::size_t limit);
+        };
+
         struct DeleteTilesAt
         {
             static std::string_view text() noexcept;
@@ -131,6 +152,25 @@ namespace DetourNavigator
                 ShapeType type, const Sqlite3::ConstBlob& hash);
         };
 
+        struct GetMaxDictionaryId
+        {
+            static std::string_view text() noexcept;
+            static void bind(sqlite3&, sqlite3_stmt&) {}
+        };
+
+        struct GetDictionary
+        {
+            static std::string_view text() noexcept;
+            static void bind(sqlite3& db, sqlite3_stmt& statement, DictionaryId dictionaryId);
+        };
+
+        struct InsertDictionary
+        {
+            static std::string_view text() noexcept;
+            static void bind(sqlite3& db, sqlite3_stmt& statement, DictionaryId dictionaryId,
+                const std::vector<std::byte>& data);
+        };
+
         struct Vacuum
         {
             static std::string_view text() noexcept;
@@ -170,6 +210,15 @@ namespace DetourNavigator
 
         int insertShape(ShapeId shapeId, std::string_view name, ShapeType type, const Sqlite3::ConstBlob& hash);
 
+        // Id of the compression dictionary used for written tiles data, zero means no dictionary
+        DictionaryId getDictionaryId() const { return mDictionaryId; }
+
+        // Makes a new compression dictionary from a random sample of stored tiles and uses it for further writes
+        DictionaryId makeDictionary(std::size_t maxSamples);
+
+        // Recompresses stored tiles data with current dictionary, returns number of changed tiles
+        std::size_t recompressTiles();
+
         void vacuum();
 
     private:
@@ -179,13 +228,23 @@ namespace DetourNavigator
         Sqlite3::Statement<DbQueries::GetTileData> mGetTileData;
         Sqlite3::Statement<DbQueries::InsertTile> mInsertTile;
         Sqlite3::Statement<DbQueries::UpdateTile> mUpdateTile;
+        Sqlite3::Statement<DbQueries::UpdateTileData> mUpdateTileData;
+        Sqlite3::Statement<DbQueries::GetTilesSample> mGetTilesSample;
+        Sqlite3::Statement<DbQueries::GetTilesWithOtherDictionary> mGetTilesWithOtherDictionary;
         Sqlite3::Statement<DbQueries::DeleteTilesAt> mDeleteTilesAt;
         Sqlite3::Statement<DbQueries::DeleteTilesAtExcept> mDeleteTilesAtExcept;
         Sqlite3::Statement<DbQueries::DeleteTilesOutsideRange> mDeleteTilesOutsideRange;
         Sqlite3::Statement<DbQueries::GetMaxShapeId> mGetMaxShapeId;
         Sqlite3::Statement<DbQueries::FindShapeId> mFindShapeId;
         Sqlite3::Statement<DbQueries::InsertShape> mInsertShape;
+        Sqlite3::Statement<DbQueries::GetMaxDictionaryId> mGetMaxDictionaryId;
+        Sqlite3::Statement<DbQueries::GetDictionary> mGetDictionary;
+        Sqlite3::Statement<DbQueries::InsertDictionary> mInsertDictionary;
         Sqlite3::Statement<DbQueries::Vacuum> mVacuum;
+        DictionaryId mDictionaryId {0};
+        std::map<DictionaryId, std::vector<std::byte>> mDictionaries;
+
+        const std::vector<std::byte>& getDictionary(DictionaryId dictionaryId);
     };
 }
 
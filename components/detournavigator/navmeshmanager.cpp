@@ -70,7 +70,8 @@ namespace DetourNavigator
             return;
         mRecastMeshManager.setWorldspace(worldspace);
         for (auto& [agent, cache] : mCache)
-            cache = std::make_shared<GuardedNavMeshCacheItem>(makeEmptyNavMesh(mSettings), ++mGenerationCounter);
+            cache = std::make_shared<GuardedNavMeshCacheItem>(makeEmptyNavMesh(mSettings), ++mGenerationCounter,
+                mSettings.mDetour.mMaxPathCacheSize);
         mWorldspace = worldspace;
     }
 
@@ -160,7 +161,8 @@ namespace DetourNavigator
         if (cached != mCache.end())
             return;
         mCache.insert(std::make_pair(agentBounds,
-            std::make_shared<GuardedNavMeshCacheItem>(makeEmptyNavMesh(mSettings), ++mGenerationCounter)));
+            std::make_shared<GuardedNavMeshCacheItem>(makeEmptyNavMesh(mSettings), ++mGenerationCounter,
+                mSettings.mDetour.mMaxPathCacheSize)));
         Log(Debug::Debug) << "cache add for agent=" << agentBounds;
     }
 
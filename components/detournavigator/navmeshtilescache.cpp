@@ -1,11 +1,32 @@
 #include "navmeshtilescache.hpp"
 
+#include <components/misc/hash.hpp>
+
 #include <osg/Stats>
 
+#include <algorithm>
 #include <cstring>
 
 namespace DetourNavigator
 {
+    namespace
+    {
+        std::size_t makeKeyHash(const AgentBounds& agentBounds, const TilePosition& changedTile,
+            const RecastMeshHash& recastMeshHash)
+        {
+            std::size_t result = 0;
+            Misc::hashCombine(result, static_cast<int>(agentBounds.mShapeType));
+            Misc::hashCombine(result, agentBounds.mHalfExtents.x());
+            Misc::hashCombine(result, agentBounds.mHalfExtents.y());
+            Misc::hashCombine(result, agentBounds.mHalfExtents.z());
+            Misc::hashCombine(result, changedTile.x());
+            Misc::hashCombine(result, changedTile.y());
+            Misc::hashCombine(result, recastMeshHash[0]);
+            Misc::hashCombine(result, recastMeshHash[1]);
+            return result;
+        }
+    }
+
     NavMeshTilesCache::NavMeshTilesCache(const std::size_t maxNavMeshDataSize)
         : mMaxNavMeshDataSize(maxNavMeshDataSize), mUsedNavMeshDataSize(0), mFreeNavMeshDataSize(0),
           mHitCount(0), mGetCount(0) {}
@@ -17,7 +38,8 @@ namespace DetourNavigator
 
         ++mGetCount;
 
-        const auto tile = mValues.find(std::tie(agentBounds, changedTile, recastMesh));
+        const auto tile = findValue(makeKeyHash(agentBounds, changedTile, recastMesh.getHash()),
+            agentBounds, changedTile, recastMesh);
         if (tile == mValues.end())
             return Value();
 
@@ -42,21 +64,23 @@ namespace DetourNavigator
         while (!mFreeItems.empty() && mUsedNavMeshDataSize + itemSize > mMaxNavMeshDataSize)
             removeLeastRecentlyUsed();
 
-        RecastMeshData key {recastMesh.getMesh(), recastMesh.getWater(),
-                    recastMesh.getHeightfields(), recastMesh.getFlatHeightfields()};
-
-        const auto iterator = mFreeItems.emplace(mFreeItems.end(), agentBounds, changedTile, std::move(key), itemSize);
-        const auto emplaced = mValues.emplace(std::make_tuple(agentBounds, changedTile, std::cref(iterator->mRecastMeshData)), iterator);
+        const std::size_t keyHash = makeKeyHash(agentBounds, changedTile, recastMesh.getHash());
 
-        if (!emplaced.second)
+        if (const auto existing = findValue(keyHash, agentBounds, changedTile, recastMesh); existing != mValues.end())
         {
-            mFreeItems.erase(iterator);
-            acquireItemUnsafe(emplaced.first->second);
+            acquireItemUnsafe(existing->second);
             ++mGetCount;
             ++mHitCount;
-            return Value(*this, emplaced.first->second);
+            return Value(*this, existing->second);
         }
 
+        RecastMeshData key {recastMesh.getMesh(), recastMesh.getWater(),
+                    recastMesh.getHeightfields(), recastMesh.getFlatHeightfields(), recastMesh.getHash()};
+
+        const auto iterator = mFreeItems.emplace(mFreeItems.end(), agentBounds, changedTile, std::move(key), itemSize,
+                                                 keyHash);
+        mValues.emplace(keyHash, iterator);
+
         iterator->mPreparedNavMeshData = std::move(value);
         ++iterator->mUseCount;
         mUsedNavMeshDataSize += itemSize;
@@ -88,12 +112,28 @@ namespace DetourNavigator
             out.setAttribute(frameNumber, "NavMesh CacheHitRate", static_cast<double>(stats.mHitCount) / stats.mGetCount * 100.0);
     }
 
+    std::unordered_multimap<std::size_t, NavMeshTilesCache::ItemIterator>::iterator NavMeshTilesCache::findValue(
+        std::size_t keyHash, const AgentBounds& agentBounds, const TilePosition& changedTile,
+        const RecastMesh& recastMesh)
+    {
+        const auto [begin, end] = mValues.equal_range(keyHash);
+        for (auto it = begin; it != end; ++it)
+        {
+            const Item& item = *it->second;
+            if (item.mAgentBounds == agentBounds && item.mChangedTile == changedTile
+                    && item.mRecastMeshData == recastMesh)
+                return it;
+        }
+        return mValues.end();
+    }
+
     void NavMeshTilesCache::removeLeastRecentlyUsed()
     {
         const auto& item = mFreeItems.back();
 
-        const auto value = mValues.find(std::tie(item.mAgentBounds, item.mChangedTile, item.mRecastMeshData));
-        if (value == mValues.end())
+        const auto [begin, end] = mValues.equal_range(item.mKeyHash);
+        const auto value = std::find_if(begin, end, [&] (const auto& v) { return &*v.second == &item; });
+        if (value == end)
             return;
 
         mUsedNavMeshDataSize -= item.mSize;
@@ -7,11 +7,11 @@
 #include "agentbounds.hpp"
 
 #include <atomic>
-#include <map>
 #include <list>
 #include <mutex>
 #include <cassert>
 #include <cstring>
+#include <unordered_map>
 #include <vector>
 
 namespace osg
@@ -27,24 +27,14 @@ namespace DetourNavigator
         std::vector<CellWater> mWater;
         std::vector<Heightfield> mHeightfields;
         std::vector<FlatHeightfield> mFlatHeightfields;
+        RecastMeshHash mHash;
     };
 
-    inline bool operator <(const RecastMeshData& lhs, const RecastMeshData& rhs)
+    inline bool operator ==(const RecastMeshData& lhs, const RecastMesh& rhs)
     {
-        return std::tie(lhs.mMesh, lhs.mWater, lhs.mHeightfields, lhs.mFlatHeightfields)
-                < std::tie(rhs.mMesh, rhs.mWater, rhs.mHeightfields, rhs.mFlatHeightfields);
-    }
-
-    inline bool operator <(const RecastMeshData& lhs, const RecastMesh& rhs)
-    {
-        return std::tie(lhs.mMesh, lhs.mWater, lhs.mHeightfields, lhs.mFlatHeightfields)
-                < std::tie(rhs.getMesh(), rhs.getWater(), rhs.getHeightfields(), rhs.getFlatHeightfields());
-    }
-
-    inline bool operator <(const RecastMesh& lhs, const RecastMeshData& rhs)
-    {
-        return std::tie(lhs.getMesh(), lhs.getWater(), lhs.getHeightfields(), lhs.getFlatHeightfields())
-                < std::tie(rhs.mMesh, rhs.mWater, rhs.mHeightfields, rhs.mFlatHeightfields);
+        return lhs.mHash == rhs.getHash()
+                && std::tie(lhs.mMesh, lhs.mWater, lhs.mHeightfields, lhs.mFlatHeightfields)
+                    == std::tie(rhs.getMesh(), rhs.getWater(), rhs.getHeightfields(), rhs.getFlatHeightfields());
     }
 
     class NavMeshTilesCache
@@ -58,14 +48,16 @@ namespace DetourNavigator
             RecastMeshData mRecastMeshData;
             std::unique_ptr<PreparedNavMeshData> mPreparedNavMeshData;
             std::size_t mSize;
+            std::size_t mKeyHash;
 
             Item(const AgentBounds& agentBounds, const TilePosition& changedTile,
-                 RecastMeshData&& recastMeshData, std::size_t size)
+                 RecastMeshData&& recastMeshData, std::size_t size, std::size_t keyHash)
                 : mUseCount(0)
                 , mAgentBounds(agentBounds)
                 , mChangedTile(changedTile)
                 , mRecastMeshData(std::move(recastMeshData))
                 , mSize(size)
+                , mKeyHash(keyHash)
             {}
         };
 
@@ -154,7 +146,12 @@ namespace DetourNavigator
         std::size_t mGetCount;
         std::list<Item> mBusyItems;
         std::list<Item> mFreeItems;
-        std::map<std::tuple<AgentBounds, TilePosition, std::reference_wrapper<const RecastMeshData>>, ItemIterator, std::less<>> mValues;
+        // Items are indexed by a hash of agent bounds, tile position and recast mesh hash. Recast mesh data is
+        // compared only for items with matching hash.
+        std::unordered_multimap<std::size_t, ItemIterator> mValues;
+
+        std::unordered_multimap<std::size_t, ItemIterator>::iterator findValue(std::size_t keyHash,
+            const AgentBounds& agentBounds, const TilePosition& changedTile, const RecastMesh& recastMesh);
 
         void removeLeastRecentlyUsed();
 
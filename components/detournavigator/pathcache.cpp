@@ -0,0 +1,57 @@
+#include "pathcache.hpp"
+
+#include <osg/Stats>
+
+namespace DetourNavigator
+{
+    void PathCache::set(const PathCacheKey& key, std::vector<dtPolyRef>&& path, TileVersions&& tiles)
+    {
+        if (mMaxSize == 0)
+            return;
+
+        // Partial path depends on tiles missing from its corridor and would be reused after they are added
+        if (path.empty() || path.back() != key.mEnd)
+            return;
+
+        if (const auto it = mValues.find(key); it != mValues.end())
+        {
+            it->second->mPath = std::move(path);
+            it->second->mTiles = std::move(tiles);
+            mItems.splice(mItems.begin(), mItems, it->second);
+            return;
+        }
+
+        while (mItems.size() >= mMaxSize)
+        {
+            mValues.erase(mItems.back().mKey);
+            mItems.pop_back();
+        }
+
+        mItems.push_front(Item {key, std::move(path), std::move(tiles)});
+        mValues.emplace(key, mItems.begin());
+    }
+
+    void PathCache::clear()
+    {
+        mValues.clear();
+        mItems.clear();
+    }
+
+    PathCache::Stats PathCache::getStats() const
+    {
+        Stats result;
+        result.mSize = mItems.size();
+        result.mHitCount = mHitCount;
+        result.mGetCount = mGetCount;
+        return result;
+    }
+
+    void reportStats(const PathCache::Stats& stats, unsigned int frameNumber, osg::Stats& out)
+    {
+        out.setAttribute(frameNumber, "NavMesh PathCacheSize", static_cast<double>(stats.mSize));
+
+        if (stats.mGetCount > 0)
+            out.setAttribute(frameNumber, "NavMesh PathCacheHitRate",
+                             static_cast<double>(stats.mHitCount) / stats.mGetCount * 100.0);
+    }
+}
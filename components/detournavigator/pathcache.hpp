@@ -0,0 +1,116 @@
+#ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_PATHCACHE_H
+#define OPENMW_COMPONENTS_DETOURNAVIGATOR_PATHCACHE_H
+
+#include "areatype.hpp"
+#include "flags.hpp"
+#include "tileposition.hpp"
+#include "version.hpp"
+
+#include <DetourNavMesh.h>
+
+#include <list>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace osg
+{
+    class Stats;
+}
+
+namespace DetourNavigator
+{
+    struct PathCacheKey
+    {
+        dtPolyRef mStart;
+        dtPolyRef mEnd;
+        Flags mIncludeFlags;
+        AreaCosts mAreaCosts;
+    };
+
+    inline auto tie(const PathCacheKey& value)
+    {
+        return std::tie(value.mStart, value.mEnd, value.mIncludeFlags, value.mAreaCosts.mWater,
+            value.mAreaCosts.mDoor, value.mAreaCosts.mPathgrid, value.mAreaCosts.mGround);
+    }
+
+    inline bool operator<(const PathCacheKey& lhs, const PathCacheKey& rhs)
+    {
+        return tie(lhs) < tie(rhs);
+    }
+
+    /**
+     * @brief Keeps least recently used polygon paths. Path is valid while all tiles it goes through have the same
+     * version as when it was added. Smoothing is done for each request because it depends on exact start and end.
+     * Not thread safe, protected by the navmesh lock.
+     */
+    class PathCache
+    {
+    public:
+        using TileVersions = std::vector<std::pair<TilePosition, Version>>;
+
+        struct Stats
+        {
+            std::size_t mSize = 0;
+            std::size_t mHitCount = 0;
+            std::size_t mGetCount = 0;
+        };
+
+        explicit PathCache(std::size_t maxSize)
+            : mMaxSize(maxSize)
+        {}
+
+        /**
+         * @param getTileVersion returns current version of a tile or empty optional if there is no such tile.
+         * @return cached path or nullptr if there is no path for key or any of its tiles is changed.
+         */
+        template <class GetTileVersion>
+        const std::vector<dtPolyRef>* get(const PathCacheKey& key, GetTileVersion&& getTileVersion)
+        {
+            if (mMaxSize == 0)
+                return nullptr;
+            ++mGetCount;
+            const auto it = mValues.find(key);
+            if (it == mValues.end())
+                return nullptr;
+            for (const auto& [position, version] : it->second->mTiles)
+            {
+                if (getTileVersion(position) != std::optional<Version>(version))
+                {
+                    mItems.erase(it->second);
+                    mValues.erase(it);
+                    return nullptr;
+                }
+            }
+            mItems.splice(mItems.begin(), mItems, it->second);
+            ++mHitCount;
+            return &it->second->mPath;
+        }
+
+        void set(const PathCacheKey& key, std::vector<dtPolyRef>&& path, TileVersions&& tiles);
+
+        void clear();
+
+        Stats getStats() const;
+
+    private:
+        struct Item
+        {
+            PathCacheKey mKey;
+            std::vector<dtPolyRef> mPath;
+            TileVersions mTiles;
+        };
+
+        std::size_t mMaxSize;
+        std::size_t mHitCount = 0;
+        std::size_t mGetCount = 0;
+        std::list<Item> mItems;
+        std::map<PathCacheKey, std::list<Item>::iterator> mValues;
+    };
+
+    void reportStats(const PathCache::Stats& stats, unsigned int frameNumber, osg::Stats& out);
+}
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_PATHRESULT_H
+#define OPENMW_COMPONENTS_DETOURNAVIGATOR_PATHRESULT_H
+
+#include "status.hpp"
+
+#include <osg/Vec3f>
+
+#include <exception>
+#include <functional>
+#include <vector>
+
+namespace DetourNavigator
+{
+    struct PathResult
+    {
+        Status mStatus = Status::Success;
+        std::vector<osg::Vec3f> mPath;
+    };
+
+    /// error is not null when the search has thrown, then result should be ignored.
+    using PathCallback = std::function<void(PathResult&& result, std::exception_ptr error)>;
+}
+
+#endif
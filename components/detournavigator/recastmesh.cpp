@@ -3,8 +3,92 @@
 
 #include <Recast.h>
 
+#include <extern/smhasher/MurmurHash3.h>
+
+#include <type_traits>
+
 namespace DetourNavigator
 {
+    namespace
+    {
+        class Hasher
+        {
+        public:
+            template <class T>
+            void add(const T& value)
+            {
+                static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>);
+                addBytes(&value, sizeof(T));
+            }
+
+            void add(const osg::Vec2i& value)
+            {
+                add(value.x());
+                add(value.y());
+            }
+
+            template <class T>
+            void add(const std::vector<T>& values)
+            {
+                static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>);
+                add(values.size());
+                addBytes(values.data(), values.size() * sizeof(T));
+            }
+
+            const RecastMeshHash& getResult() const noexcept { return mResult; }
+
+        private:
+            RecastMeshHash mResult {0, 0};
+
+            void addBytes(const void* data, std::size_t size)
+            {
+                if (size == 0)
+                    return;
+                RecastMeshHash result {0, 0};
+                MurmurHash3_x64_128(data, static_cast<int>(size), mResult.data(), result.data());
+                mResult = result;
+            }
+        };
+    }
+
+    RecastMeshHash makeRecastMeshHash(const Mesh& mesh, const std::vector<CellWater>& water,
+        const std::vector<Heightfield>& heightfields, const std::vector<FlatHeightfield>& flatHeightfields)
+    {
+        // Fields are hashed one by one to not depend on padding bytes
+        Hasher hasher;
+        hasher.add(mesh.getIndices());
+        hasher.add(mesh.getVertices());
+        hasher.add(mesh.getAreaTypes());
+        hasher.add(water.size());
+        for (const CellWater& v : water)
+        {
+            hasher.add(v.mCellPosition);
+            hasher.add(v.mWater.mCellSize);
+            hasher.add(v.mWater.mLevel);
+        }
+        hasher.add(heightfields.size());
+        for (const Heightfield& v : heightfields)
+        {
+            hasher.add(v.mCellPosition);
+            hasher.add(v.mCellSize);
+            hasher.add(v.mLength);
+            hasher.add(v.mMinHeight);
+            hasher.add(v.mMaxHeight);
+            hasher.add(v.mHeights);
+            hasher.add(v.mOriginalSize);
+            hasher.add(v.mMinX);
+            hasher.add(v.mMinY);
+        }
+        hasher.add(flatHeightfields.size());
+        for (const FlatHeightfield& v : flatHeightfields)
+        {
+            hasher.add(v.mCellPosition);
+            hasher.add(v.mCellSize);
+            hasher.add(v.mHeight);
+        }
+        return hasher.getResult();
+    }
+
     Mesh::Mesh(std::vector<int>&& indices, std::vector<float>&& vertices, std::vector<AreaType>&& areaTypes)
     {
         if (indices.size() / 3 != areaTypes.size())
@@ -33,5 +117,6 @@ namespace DetourNavigator
         mHeightfields.shrink_to_fit();
         for (Heightfield& v : mHeightfields)
             v.mHeights.shrink_to_fit();
+        mHash = makeRecastMeshHash(mMesh, mWater, mHeightfields, mFlatHeightfields);
     }
 }
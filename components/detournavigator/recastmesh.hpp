@@ -10,6 +10,8 @@
 #include <osg/Vec3f>
 #include <osg/Vec2i>
 
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -40,6 +42,12 @@ namespace DetourNavigator
                     < std::tie(rhs.mIndices, rhs.mVertices, rhs.mAreaTypes);
         }
 
+        friend inline bool operator==(const Mesh& lhs, const Mesh& rhs) noexcept
+        {
+            return std::tie(lhs.mIndices, lhs.mVertices, lhs.mAreaTypes)
+                    == std::tie(rhs.mIndices, rhs.mVertices, rhs.mAreaTypes);
+        }
+
         friend inline std::size_t getSize(const Mesh& value) noexcept
         {
             return value.mIndices.size() * sizeof(int)
@@ -60,6 +68,12 @@ namespace DetourNavigator
         return tie(lhs) < tie(rhs);
     }
 
+    inline bool operator==(const Water& lhs, const Water& rhs) noexcept
+    {
+        const auto tie = [] (const Water& v) { return std::tie(v.mCellSize, v.mLevel); };
+        return tie(lhs) == tie(rhs);
+    }
+
     struct CellWater
     {
         osg::Vec2i mCellPosition;
@@ -72,6 +86,12 @@ namespace DetourNavigator
         return tie(lhs) < tie(rhs);
     }
 
+    inline bool operator==(const CellWater& lhs, const CellWater& rhs) noexcept
+    {
+        const auto tie = [] (const CellWater& v) { return std::tie(v.mCellPosition, v.mWater); };
+        return tie(lhs) == tie(rhs);
+    }
+
     inline osg::Vec2f getWaterShift2d(const osg::Vec2i& cellPosition, int cellSize)
     {
         return osg::Vec2f((cellPosition.x() + 0.5f) * cellSize, (cellPosition.y() + 0.5f) * cellSize);
@@ -106,6 +126,11 @@ namespace DetourNavigator
         return makeTuple(lhs) < makeTuple(rhs);
     }
 
+    inline bool operator==(const Heightfield& lhs, const Heightfield& rhs) noexcept
+    {
+        return makeTuple(lhs) == makeTuple(rhs);
+    }
+
     struct FlatHeightfield
     {
         osg::Vec2i mCellPosition;
@@ -119,6 +144,19 @@ namespace DetourNavigator
         return tie(lhs) < tie(rhs);
     }
 
+    inline bool operator==(const FlatHeightfield& lhs, const FlatHeightfield& rhs) noexcept
+    {
+        const auto tie = [] (const FlatHeightfield& v) { return std::tie(v.mCellPosition, v.mCellSize, v.mHeight); };
+        return tie(lhs) == tie(rhs);
+    }
+
+    /// 128-bit hash of the recast mesh geometry. Equal content always gives an equal hash, different content gives
+    /// a different one with overwhelming probability, so it can be used as a cheap key before a full comparison.
+    using RecastMeshHash = std::array<std::uint64_t, 2>;
+
+    RecastMeshHash makeRecastMeshHash(const Mesh& mesh, const std::vector<CellWater>& water,
+        const std::vector<Heightfield>& heightfields, const std::vector<FlatHeightfield>& flatHeightfields);
+
     struct MeshSource
     {
         osg::ref_ptr<const Resource::BulletShape> mShape;
@@ -162,6 +200,8 @@ namespace DetourNavigator
 
         const std::vector<MeshSource>& getMeshSources() const noexcept { return mMeshSources; }
 
+        const RecastMeshHash& getHash() const noexcept { return mHash; }
+
     private:
         std::size_t mGeneration;
         std::size_t mRevision;
@@ -170,6 +210,7 @@ namespace DetourNavigator
         std::vector<Heightfield> mHeightfields;
         std::vector<FlatHeightfield> mFlatHeightfields;
         std::vector<MeshSource> mMeshSources;
+        RecastMeshHash mHash;
 
         friend inline std::size_t getSize(const RecastMesh& value) noexcept
         {
@@ -40,6 +40,7 @@ namespace DetourNavigator
         result.mMaxPolys = std::clamp(::Settings::Manager::getInt("max polygons per tile", "Navigator"), 1, (1 << 22) - 1);
         result.mMaxPolygonPathSize = static_cast<std::size_t>(std::max(0, ::Settings::Manager::getInt("max polygon path size", "Navigator")));
         result.mMaxSmoothPathSize = static_cast<std::size_t>(std::max(0, ::Settings::Manager::getInt("max smooth path size", "Navigator")));
+        result.mMaxPathCacheSize = static_cast<std::size_t>(std::max(0, ::Settings::Manager::getInt("max path cache size", "Navigator")));
 
         return result;
     }
@@ -53,6 +54,7 @@ namespace DetourNavigator
         result.mMaxTilesNumber = std::max(0, ::Settings::Manager::getInt("max tiles number", "Navigator"));
         result.mWaitUntilMinDistanceToPlayer = ::Settings::Manager::getInt("wait until min distance to player", "Navigator");
         result.mAsyncNavMeshUpdaterThreads = static_cast<std::size_t>(std::max(0, ::Settings::Manager::getInt("async nav mesh updater threads", "Navigator")));
+        result.mAsyncPathfinderThreads = static_cast<std::size_t>(std::max(0, ::Settings::Manager::getInt("async pathfinder threads", "Navigator")));
         result.mMaxNavMeshTilesCacheSize = static_cast<std::size_t>(std::max(std::int64_t {0}, ::Settings::Manager::getInt64("max nav mesh tiles cache size", "Navigator")));
         result.mEnableWriteRecastMeshToFile = ::Settings::Manager::getBool("enable write recast mesh to file", "Navigator");
         result.mEnableWriteNavMeshToFile = ::Settings::Manager::getBool("enable write nav mesh to file", "Navigator");
@@ -64,6 +66,8 @@ namespace DetourNavigator
         result.mEnableNavMeshDiskCache = ::Settings::Manager::getBool("enable nav mesh disk cache", "Navigator");
         result.mWriteToNavMeshDb = ::Settings::Manager::getBool("write to navmeshdb", "Navigator");
         result.mMaxDbFileSize = static_cast<std::uint64_t>(::Settings::Manager::getInt64("max navmeshdb file size", "Navigator"));
+        result.mDbWriteBatchSize = static_cast<std::size_t>(std::max(1, ::Settings::Manager::getInt("navmeshdb write batch size", "Navigator")));
+        result.mDbWriteBatchInterval = std::chrono::milliseconds(std::max(0, ::Settings::Manager::getInt("navmeshdb write batch interval ms", "Navigator")));
 
         return result;
     }
@@ -31,6 +31,7 @@ namespace DetourNavigator
         int mMaxNavMeshQueryNodes = 0;
         std::size_t mMaxPolygonPathSize = 0;
         std::size_t mMaxSmoothPathSize = 0;
+        std::size_t mMaxPathCacheSize = 0;
     };
 
     struct Settings
@@ -46,14 +47,25 @@ namespace DetourNavigator
         int mWaitUntilMinDistanceToPlayer = 0;
         int mMaxTilesNumber = 0;
         std::size_t mAsyncNavMeshUpdaterThreads = 0;
+        std::size_t mAsyncPathfinderThreads = 0;
         std::size_t mMaxNavMeshTilesCacheSize = 0;
         std::string mRecastMeshPathPrefix;
         std::string mNavMeshPathPrefix;
         std::chrono::milliseconds mMinUpdateInterval;
         std::uint64_t mMaxDbFileSize = 0;
+        std::size_t mDbWriteBatchSize = 1;
+        std::chrono::milliseconds mDbWriteBatchInterval {0};
     };
 
-    inline constexpr std::int64_t navMeshFormatVersion = 2;
+    inline constexpr std::int64_t navMeshFormatVersion = 3;
+
+    // Version 2 tiles are stored without a compression dictionary and are still valid
+    inline constexpr std::int64_t minNavMeshFormatVersion = 2;
+
+    inline constexpr bool isSupportedNavMeshFormatVersion(std::int64_t value)
+    {
+        return minNavMeshFormatVersion <= value && value <= navMeshFormatVersion;
+    }
 
     RecastSettings makeRecastSettingsFromSettingsManager();
 
@@ -5,6 +5,8 @@
 #include <string_view>
 #include <vector>
 
+#include "types.hpp"
+
 namespace Interpreter
 {
     class Context
@@ -80,18 +82,26 @@ namespace Interpreter
 
             virtual std::string_view getCurrentCellName() const = 0;
 
-            virtual int getMemberShort(std::string_view id, std::string_view name, bool global) const = 0;
+            /// \a slot keeps the variable index resolved for the accessing call site between runs
+            /// (nullptr: resolve on each access).
+
+            virtual int getMemberShort(std::string_view id, std::string_view name, bool global,
+                MemberSlot* slot) const = 0;
 
-            virtual int getMemberLong(std::string_view id, std::string_view name, bool global) const = 0;
+            virtual int getMemberLong(std::string_view id, std::string_view name, bool global,
+                MemberSlot* slot) const = 0;
 
-            virtual float getMemberFloat(std::string_view id, std::string_view name, bool global) const = 0;
+            virtual float getMemberFloat(std::string_view id, std::string_view name, bool global,
+                MemberSlot* slot) const = 0;
 
-            virtual void setMemberShort(std::string_view id, std::string_view name, int value, bool global) = 0;
+            virtual void setMemberShort(std::string_view id, std::string_view name, int value, bool global,
+                MemberSlot* slot) = 0;
 
-            virtual void setMemberLong(std::string_view id, std::string_view name, int value, bool global) = 0;
+            virtual void setMemberLong(std::string_view id, std::string_view name, int value, bool global,
+                MemberSlot* slot) = 0;
 
-            virtual void setMemberFloat(std::string_view id, std::string_view name, float value, bool global)
-                = 0;
+            virtual void setMemberFloat(std::string_view id, std::string_view name, float value, bool global,
+                MemberSlot* slot) = 0;
     };
 }
 
@@ -70,6 +70,7 @@ namespace Interpreter
             {
                 const int opcode = code & 0x3ffffff;
 
+                mRuntime.setMemberSlot(nullptr);
                 return getDispatcher(mSegment5, 5, opcode)->execute(mRuntime);
             }
         }
@@ -77,6 +78,76 @@ namespace Interpreter
         abortUnknownSegment (code);
     }
 
+    template<typename T>
+    T* findOpcode(const std::map<int, std::unique_ptr<T>>& segment, int opcode)
+    {
+        const auto it = segment.find(opcode);
+        if (it == segment.end())
+            return nullptr;
+        return it->second.get();
+    }
+
+    Program Interpreter::prepare (const Type_Code *code, int codeSize) const
+    {
+        assert (codeSize>=4);
+
+        const int opcodes = static_cast<int> (code[0]);
+        const Type_Code *codeBlock = code + 4;
+
+        Program result(static_cast<std::size_t>(opcodes));
+
+        for (int i = 0; i < opcodes; ++i)
+        {
+            const Type_Code value = codeBlock[i];
+            Instruction& instruction = result[static_cast<std::size_t>(i)];
+
+            switch (value >> 30)
+            {
+                case 0:
+                    instruction.mOpcode1 = findOpcode(mSegment0, value >> 24);
+                    instruction.mArg0 = value & 0xffffff;
+                    break;
+                case 2:
+                    instruction.mOpcode1 = findOpcode(mSegment2, (value >> 20) & 0x3ff);
+                    instruction.mArg0 = value & 0xfffff;
+                    break;
+                default:
+                    switch (value >> 26)
+                    {
+                        case 0x30:
+                            instruction.mOpcode1 = findOpcode(mSegment3, (value >> 8) & 0x3ffff);
+                            instruction.mArg0 = value & 0xff;
+                            break;
+                        case 0x32:
+                            instruction.mOpcode0 = findOpcode(mSegment5, value & 0x3ffffff);
+                            if (instruction.mOpcode0 != nullptr && instruction.mOpcode0->hasMemberSlot())
+                                instruction.mMemberSlot = std::make_unique<MemberSlot>();
+                            break;
+                    }
+            }
+
+            // Keep the code to report the error on execution
+            if (instruction.mOpcode1 == nullptr && instruction.mOpcode0 == nullptr)
+                instruction.mArg0 = value;
+        }
+
+        return result;
+    }
+
+    void Interpreter::execute (const Instruction& instruction)
+    {
+        if (instruction.mOpcode1 != nullptr)
+            return instruction.mOpcode1->execute(mRuntime, instruction.mArg0);
+
+        if (instruction.mOpcode0 != nullptr)
+        {
+            mRuntime.setMemberSlot(instruction.mMemberSlot.get());
+            return instruction.mOpcode0->execute(mRuntime);
+        }
+
+        execute (static_cast<Type_Code> (instruction.mArg0));
+    }
+
     void Interpreter::begin()
     {
         if (mRunning)
@@ -107,7 +178,8 @@ namespace Interpreter
     Interpreter::Interpreter() : mRunning (false)
     {}
 
-    void Interpreter::run (const Type_Code *code, int codeSize, Context& context)
+    template <class Function>
+    void Interpreter::run (const Type_Code *code, int codeSize, Context& context, Function&& execute)
     {
         assert (codeSize>=4);
 
@@ -119,13 +191,11 @@ namespace Interpreter
 
             int opcodes = static_cast<int> (code[0]);
 
-            const Type_Code *codeBlock = code + 4;
-
             while (mRuntime.getPC()>=0 && mRuntime.getPC()<opcodes)
             {
-                Type_Code runCode = codeBlock[mRuntime.getPC()];
-                mRuntime.setPC (mRuntime.getPC()+1);
-                execute (runCode);
+                const int pc = mRuntime.getPC();
+                mRuntime.setPC (pc+1);
+                execute (pc);
             }
         }
         catch (...)
@@ -136,4 +206,20 @@ namespace Interpreter
 
         end();
     }
+
+    void Interpreter::run (const Type_Code *code, int codeSize, Context& context)
+    {
+        const Type_Code *codeBlock = code + 4;
+
+        run (code, codeSize, context, [&] (int pc) { execute (codeBlock[pc]); });
+    }
+
+    void Interpreter::run (const Type_Code *code, int codeSize, const Program& program, Context& context)
+    {
+        assert (codeSize>=4 && program.size() == static_cast<std::size_t> (code[0]));
+
+        const Instruction *instructions = program.data();
+
+        run (code, codeSize, context, [&] (int pc) { execute (instructions[pc]); });
+    }
 }
@@ -6,6 +6,7 @@
 #include <memory>
 #include <cassert>
 #include <utility>
+#include <vector>
 
 #include "runtime.hpp"
 #include "types.hpp"
@@ -13,6 +14,20 @@
 
 namespace Interpreter
 {
+    /// Instruction with resolved opcode and unpacked argument.
+    struct Instruction
+    {
+        Opcode1* mOpcode1 = nullptr;
+        Opcode0* mOpcode0 = nullptr;
+        /// Argument for mOpcode1 or the original code when the opcode is unknown
+        unsigned int mArg0 = 0;
+        /// Resolved member variable for mOpcode0 accessing one
+        std::unique_ptr<MemberSlot> mMemberSlot;
+    };
+
+    /// Instructions for each code of a script, indexed by program counter.
+    using Program = std::vector<Instruction>;
+
     class Interpreter
     {
             std::stack<Runtime> mCallstack;
@@ -29,6 +44,11 @@ namespace Interpreter
 
             void execute (Type_Code code);
 
+            void execute (const Instruction& instruction);
+
+            template <class Function>
+            void run (const Type_Code *code, int codeSize, Context& context, Function&& execute);
+
             void begin();
 
             void end();
@@ -69,6 +89,14 @@ namespace Interpreter
             }
 
             void run (const Type_Code *code, int codeSize, Context& context);
+
+            Program prepare (const Type_Code *code, int codeSize) const;
+            ///< Decode code once to run it without decoding and opcode lookup for each instruction. Unknown
+            /// opcodes are reported when executed, same as by run without a program.
+            /// \note Program is valid as long as installed opcodes are not changed.
+
+            void run (const Type_Code *code, int codeSize, const Program& program, Context& context);
+            ///< Run \a program prepared for \a code.
     };
 }
 
@@ -211,6 +211,8 @@ namespace Interpreter
     {
         public:
 
+            bool hasMemberSlot() const override { return true; }
+
             void execute (Runtime& runtime) override
             {
                 Type_Integer data = runtime[0].mInteger;
@@ -219,7 +221,7 @@ namespace Interpreter
                 index = runtime[2].mInteger;
                 std::string_view variable = runtime.getStringLiteral (index);
 
-                runtime.getContext().setMemberShort (id, variable, data, TGlobal);
+                runtime.getContext().setMemberShort (id, variable, data, TGlobal, runtime.getMemberSlot());
 
                 runtime.pop();
                 runtime.pop();
@@ -232,6 +234,8 @@ namespace Interpreter
     {
         public:
 
+            bool hasMemberSlot() const override { return true; }
+
             void execute (Runtime& runtime) override
             {
                 Type_Integer data = runtime[0].mInteger;
@@ -240,7 +244,7 @@ namespace Interpreter
                 index = runtime[2].mInteger;
                 std::string_view variable = runtime.getStringLiteral (index);
 
-                runtime.getContext().setMemberLong (id, variable, data, TGlobal);
+                runtime.getContext().setMemberLong (id, variable, data, TGlobal, runtime.getMemberSlot());
 
                 runtime.pop();
                 runtime.pop();
@@ -253,6 +257,8 @@ namespace Interpreter
     {
         public:
 
+            bool hasMemberSlot() const override { return true; }
+
             void execute (Runtime& runtime) override
             {
                 Type_Float data = runtime[0].mFloat;
@@ -261,7 +267,7 @@ namespace Interpreter
                 index = runtime[2].mInteger;
                 std::string_view variable = runtime.getStringLiteral (index);
 
-                runtime.getContext().setMemberFloat (id, variable, data, TGlobal);
+                runtime.getContext().setMemberFloat (id, variable, data, TGlobal, runtime.getMemberSlot());
 
                 runtime.pop();
                 runtime.pop();
@@ -274,6 +280,8 @@ namespace Interpreter
     {
         public:
 
+            bool hasMemberSlot() const override { return true; }
+
             void execute (Runtime& runtime) override
             {
                 Type_Integer index = runtime[0].mInteger;
@@ -282,7 +290,7 @@ namespace Interpreter
                 std::string_view variable = runtime.getStringLiteral (index);
                 runtime.pop();
 
-                int value = runtime.getContext().getMemberShort (id, variable, TGlobal);
+                int value = runtime.getContext().getMemberShort (id, variable, TGlobal, runtime.getMemberSlot());
                 runtime[0].mInteger = value;
             }
     };
@@ -292,6 +300,8 @@ namespace Interpreter
     {
         public:
 
+            bool hasMemberSlot() const override { return true; }
+
             void execute (Runtime& runtime) override
             {
                 Type_Integer index = runtime[0].mInteger;
@@ -300,7 +310,7 @@ namespace Interpreter
                 std::string_view variable = runtime.getStringLiteral (index);
                 runtime.pop();
 
-                int value = runtime.getContext().getMemberLong (id, variable, TGlobal);
+                int value = runtime.getContext().getMemberLong (id, variable, TGlobal, runtime.getMemberSlot());
                 runtime[0].mInteger = value;
             }
     };
@@ -310,6 +320,8 @@ namespace Interpreter
     {
         public:
 
+            bool hasMemberSlot() const override { return true; }
+
             void execute (Runtime& runtime) override
             {
                 Type_Integer index = runtime[0].mInteger;
@@ -318,7 +330,7 @@ namespace Interpreter
                 std::string_view variable = runtime.getStringLiteral (index);
                 runtime.pop();
 
-                float value = runtime.getContext().getMemberFloat (id, variable, TGlobal);
+                float value = runtime.getContext().getMemberFloat (id, variable, TGlobal, runtime.getMemberSlot());
                 runtime[0].mFloat = value;
             }
     };
@@ -11,6 +11,9 @@ namespace Interpreter
         public:
         
             virtual void execute (Runtime& runtime) = 0;
+
+            virtual bool hasMemberSlot() const { return false; }
+            ///< Prepared programs keep a MemberSlot for each call site of this opcode.
             
             virtual ~Opcode0() {}
     };
@@ -6,7 +6,7 @@
 
 namespace Interpreter
 {
-    Runtime::Runtime() : mContext (nullptr), mCode (nullptr), mCodeSize(0), mPC (0) {}
+    Runtime::Runtime() : mContext (nullptr), mCode (nullptr), mCodeSize(0), mPC (0), mMemberSlot (nullptr) {}
 
     int Runtime::getPC() const
     {
@@ -69,6 +69,7 @@ namespace Interpreter
         mCode = nullptr;
         mCodeSize = 0;
         mStack.clear();
+        mMemberSlot = nullptr;
     }
 
     void Runtime::setPC (int PC)
@@ -116,4 +117,14 @@ namespace Interpreter
         assert (mContext);
         return *mContext;
     }
+
+    void Runtime::setMemberSlot (MemberSlot *slot)
+    {
+        mMemberSlot = slot;
+    }
+
+    MemberSlot *Runtime::getMemberSlot()
+    {
+        return mMemberSlot;
+    }
 }
@@ -19,6 +19,7 @@ namespace Interpreter
             int mCodeSize;
             int mPC;
             std::vector<Data> mStack;
+            MemberSlot *mMemberSlot;
 
         public:
 
@@ -58,6 +59,11 @@ namespace Interpreter
             ///< Access stack member, counted from the top.
 
             Context& getContext();
+
+            void setMemberSlot (MemberSlot *slot);
+
+            MemberSlot *getMemberSlot();
+            ///< Slot of the executed instruction, nullptr if there is none.
     };
 }
 
@@ -1,7 +1,9 @@
 #ifndef INTERPRETER_TYPES_H_INCLUDED
 #define INTERPRETER_TYPES_H_INCLUDED
 
+#include <cstdint>
 #include <stdexcept>
+#include <string>
 
 namespace Interpreter
 {
@@ -20,6 +22,15 @@ namespace Interpreter
         Type_Integer mInteger;
         Type_Float mFloat;
     };
+
+    /// Member variable index resolved by Context for a single call site of a prepared program.
+    /// Context decides by the script id and revision whether the index can be reused.
+    struct MemberSlot
+    {
+        std::string mScriptId;
+        std::uint64_t mRevision = 0;
+        int mIndex = -1;
+    };
     
     template<typename T>
     T& getData (Data& data)
@@ -4,39 +4,102 @@
 
 #include <cstddef>
 #include <cstring>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
 namespace Misc
 {
+    namespace
+    {
+        // LZ4 uses only last 64KB of the dictionary
+        constexpr std::size_t maxDictionarySize = 64 * 1024;
+
+        struct FreeLz4Stream
+        {
+            void operator()(LZ4_stream_t* stream) const noexcept
+            {
+                LZ4_freeStream(stream);
+            }
+        };
+
+        LZ4_stream_t& getLz4Stream()
+        {
+            thread_local const std::unique_ptr<LZ4_stream_t, FreeLz4Stream> stream(LZ4_createStream());
+            if (stream == nullptr)
+                throw std::runtime_error("Failed to create LZ4 stream");
+            return *stream;
+        }
+
+        std::vector<char>& getCompressBuffer(std::size_t size)
+        {
+            // Compression bound may be much bigger than the result so use a reusable buffer and copy only the result
+            thread_local std::vector<char> buffer;
+            if (buffer.size() < size)
+                buffer.resize(size);
+            return buffer;
+        }
+    }
+
     std::vector<std::byte> compress(const std::vector<std::byte>& data)
+    {
+        return compress(data, {});
+    }
+
+    std::vector<std::byte> decompress(const std::vector<std::byte>& data)
+    {
+        return decompress(data, {});
+    }
+
+    std::vector<std::byte> compress(const std::vector<std::byte>& data, const std::vector<std::byte>& dictionary)
     {
         const std::size_t originalSize = data.size();
-        std::vector<std::byte> result(static_cast<std::size_t>(LZ4_compressBound(static_cast<int>(originalSize)) + sizeof(originalSize)));
-        const int size = LZ4_compress_default(
-            reinterpret_cast<const char*>(data.data()),
-            reinterpret_cast<char*>(result.data()) + sizeof(originalSize),
-            static_cast<int>(data.size()),
-            static_cast<int>(result.size() - sizeof(originalSize))
-        );
+        const int bound = LZ4_compressBound(static_cast<int>(originalSize));
+        std::vector<char>& buffer = getCompressBuffer(static_cast<std::size_t>(bound));
+        int size = 0;
+        if (dictionary.empty())
+        {
+            size = LZ4_compress_default(
+                reinterpret_cast<const char*>(data.data()),
+                buffer.data(),
+                static_cast<int>(originalSize),
+                bound
+            );
+        }
+        else
+        {
+            LZ4_stream_t& stream = getLz4Stream();
+            LZ4_loadDict(&stream, reinterpret_cast<const char*>(dictionary.data()), static_cast<int>(dictionary.size()));
+            size = LZ4_compress_fast_continue(
+                &stream,
+                reinterpret_cast<const char*>(data.data()),
+                buffer.data(),
+                static_cast<int>(originalSize),
+                bound,
+                1
+            );
+        }
         if (size == 0)
             throw std::runtime_error("Failed to compress");
+        std::vector<std::byte> result(static_cast<std::size_t>(size) + sizeof(originalSize));
         std::memcpy(result.data(), &originalSize, sizeof(originalSize));
-        result.resize(static_cast<std::size_t>(size) + sizeof(originalSize));
+        std::memcpy(result.data() + sizeof(originalSize), buffer.data(), static_cast<std::size_t>(size));
         return result;
     }
 
-    std::vector<std::byte> decompress(const std::vector<std::byte>& data)
+    std::vector<std::byte> decompress(const std::vector<std::byte>& data, const std::vector<std::byte>& dictionary)
     {
         std::size_t originalSize;
         std::memcpy(&originalSize, data.data(), sizeof(originalSize));
         std::vector<std::byte> result(originalSize);
-        const int size = LZ4_decompress_safe(
+        const int size = LZ4_decompress_safe_usingDict(
             reinterpret_cast<const char*>(data.data()) + sizeof(originalSize),
             reinterpret_cast<char*>(result.data()),
             static_cast<int>(data.size() - sizeof(originalSize)),
-            static_cast<int>(result.size())
+            static_cast<int>(result.size()),
+            reinterpret_cast<const char*>(dictionary.data()),
+            static_cast<int>(dictionary.size())
         );
         if (size < 0)
             throw std::runtime_error("Failed to decompress");
@@ -45,4 +108,17 @@ namespace Misc
                                      + ") doesn't match stored (" + std::to_string(originalSize) + ")");
         return result;
     }
+
+    std::vector<std::byte> makeCompressionDictionary(const std::vector<std::vector<std::byte>>& samples)
+    {
+        std::vector<std::byte> result;
+        for (const std::vector<std::byte>& sample : samples)
+        {
+            // Smaller samples after a too large one may still fit
+            if (result.size() + sample.size() > maxDictionarySize)
+                continue;
+            result.insert(result.end(), sample.begin(), sample.end());
+        }
+        return result;
+    }
 }
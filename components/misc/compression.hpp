@@ -9,6 +9,16 @@ namespace Misc
     std::vector<std::byte> compress(const std::vector<std::byte>& data);
 
     std::vector<std::byte> decompress(const std::vector<std::byte>& data);
+
+    // Dictionary is a sample of data similar to the one being compressed. It has to be the same for compression and
+    // decompression. Empty dictionary gives the same result as compression without dictionary.
+    std::vector<std::byte> compress(const std::vector<std::byte>& data, const std::vector<std::byte>& dictionary);
+
+    std::vector<std::byte> decompress(const std::vector<std::byte>& data, const std::vector<std::byte>& dictionary);
+
+    // Makes dictionary from given samples concatenating them up to the max dictionary size supported by the codec.
+    // Samples at the end of the list have more effect.
+    std::vector<std::byte> makeCompressionDictionary(const std::vector<std::vector<std::byte>>& samples);
 }
 
 #endif
@@ -0,0 +1,62 @@
+#ifndef OPENMW_COMPONENTS_MISC_PARALLELFOR_H
+#define OPENMW_COMPONENTS_MISC_PARALLELFOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Misc
+{
+    /// Call function for each index in [0, count) using up to threadsCount threads including the calling one.
+    /// First thrown exception is rethrown after all threads are finished.
+    template <class Function>
+    void parallelFor(std::size_t count, std::size_t threadsCount, Function&& function)
+    {
+        threadsCount = std::max<std::size_t>(1, std::min(threadsCount, count));
+
+        std::atomic_size_t next {0};
+        std::exception_ptr exception;
+        std::mutex exceptionMutex;
+
+        const auto run = [&]
+        {
+            for (std::size_t i = next++; i < count; i = next++)
+            {
+                try
+                {
+                    function(i);
+                }
+                catch (...)
+                {
+                    const std::lock_guard<std::mutex> lock(exceptionMutex);
+                    if (exception == nullptr)
+                        exception = std::current_exception();
+                    next = count;
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(threadsCount - 1);
+        for (std::size_t i = 1; i < threadsCount; ++i)
+            threads.emplace_back(run);
+        run();
+        for (std::thread& thread : threads)
+            thread.join();
+
+        if (exception != nullptr)
+            std::rethrow_exception(exception);
+    }
+
+    template <class Function>
+    void parallelFor(std::size_t count, Function&& function)
+    {
+        parallelFor(count, std::thread::hardware_concurrency(), std::forward<Function>(function));
+    }
+}
+
+#endif
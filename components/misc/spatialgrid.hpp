@@ -0,0 +1,134 @@
+#ifndef OPENMW_COMPONENTS_MISC_SPATIALGRID_H
+#define OPENMW_COMPONENTS_MISC_SPATIALGRID_H
+
+#include <osg/Vec3f>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Misc
+{
+    /// Uniform grid over the XY plane for radius queries over a set of points that is rebuilt as a whole.
+    template <class T>
+    class SpatialGrid
+    {
+        public:
+            explicit SpatialGrid(float cellSize) : mCellSize(cellSize) {}
+
+            float getCellSize() const { return mCellSize; }
+
+            std::size_t size() const { return mItems.size(); }
+
+            bool empty() const { return mItems.empty(); }
+
+            void clear()
+            {
+                mItems.clear();
+                mCells.clear();
+            }
+
+            /// Add value at position. Queries see it only after build.
+            void add(const osg::Vec3f& position, const T& value)
+            {
+                mItems.push_back(Item {getCellKey(getCellIndex(position.x()), getCellIndex(position.y())),
+                    position, value});
+            }
+
+            /// Index values added since the last clear.
+            void build()
+            {
+                std::stable_sort(mItems.begin(), mItems.end(),
+                    [] (const Item& lhs, const Item& rhs) { return lhs.mCellKey < rhs.mCellKey; });
+
+                mCells.clear();
+                for (std::size_t begin = 0; begin < mItems.size();)
+                {
+                    std::size_t end = begin + 1;
+                    while (end < mItems.size() && mItems[end].mCellKey == mItems[begin].mCellKey)
+                        ++end;
+                    mCells.emplace(mItems[begin].mCellKey, std::make_pair(begin, end));
+                    begin = end;
+                }
+            }
+
+            /// Call function(value) for each value within radius of position (3D distance).
+            template <class Function>
+            void forEachInRange(const osg::Vec3f& position, float radius, Function&& function) const
+            {
+                visitInRange(position, radius, [&] (const T& value) { function(value); return true; });
+            }
+
+            /// Check if there is any value within radius of position (3D distance).
+            bool anyInRange(const osg::Vec3f& position, float radius) const
+            {
+                return !visitInRange(position, radius, [] (const T&) { return false; });
+            }
+
+        private:
+            struct Item
+            {
+                std::uint64_t mCellKey;
+                osg::Vec3f mPosition;
+                T mValue;
+            };
+
+            float mCellSize;
+            std::vector<Item> mItems;
+            std::unordered_map<std::uint64_t, std::pair<std::size_t, std::size_t>> mCells;
+
+            int getCellIndex(float value) const
+            {
+                return static_cast<int>(std::floor(value / mCellSize));
+            }
+
+            /// Call visitor(value) for values within radius of position until it returns false.
+            /// @return false if visiting was stopped.
+            template <class Visitor>
+            bool visitInRange(const osg::Vec3f& position, float radius, Visitor&& visitor) const
+            {
+                const float radius2 = radius * radius;
+                const auto visit = [&] (std::size_t begin, std::size_t end)
+                {
+                    for (std::size_t i = begin; i < end; ++i)
+                        if ((mItems[i].mPosition - position).length2() <= radius2 && !visitor(mItems[i].mValue))
+                            return false;
+                    return true;
+                };
+
+                const float minX = std::floor((position.x() - radius) / mCellSize);
+                const float maxX = std::floor((position.x() + radius) / mCellSize);
+                const float minY = std::floor((position.y() - radius) / mCellSize);
+                const float maxY = std::floor((position.y() + radius) / mCellSize);
+
+                // Checking every item is cheaper than looking up more cells than there are occupied
+                if (!(static_cast<double>(maxX - minX + 1) * static_cast<double>(maxY - minY + 1)
+                        < static_cast<double>(mCells.size())))
+                    return visit(0, mItems.size());
+
+                for (int x = static_cast<int>(minX), endX = static_cast<int>(maxX); x <= endX; ++x)
+                {
+                    for (int y = static_cast<int>(minY), endY = static_cast<int>(maxY); y <= endY; ++y)
+                    {
+                        const auto it = mCells.find(getCellKey(x, y));
+                        if (it != mCells.end() && !visit(it->second.first, it->second.second))
+                            return false;
+                    }
+                }
+
+                return true;
+            }
+
+            static std::uint64_t getCellKey(int x, int y)
+            {
+                return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32)
+                    | static_cast<std::uint32_t>(y);
+            }
+    };
+}
+
+#endif
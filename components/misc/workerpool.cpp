@@ -0,0 +1,97 @@
+#include "workerpool.hpp"
+
+#include <algorithm>
+
+namespace Misc
+{
+    WorkerPool::WorkerPool(std::size_t threadsCount)
+    {
+        threadsCount = std::max<std::size_t>(1, threadsCount);
+        mThreads.reserve(threadsCount - 1);
+        for (std::size_t i = 1; i < threadsCount; ++i)
+            mThreads.emplace_back([this] { run(); });
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        {
+            const std::lock_guard<std::mutex> lock(mMutex);
+            mDone = true;
+        }
+        mHasJob.notify_all();
+        for (std::thread& thread : mThreads)
+            thread.join();
+    }
+
+    void WorkerPool::parallelFor(std::size_t count, const std::function<void(std::size_t)>& function)
+    {
+        if (mThreads.empty() || count <= 1)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                function(i);
+            return;
+        }
+
+        {
+            const std::lock_guard<std::mutex> lock(mMutex);
+            mFunction = &function;
+            mCount = count;
+            mNext = 0;
+            mBusy = mThreads.size();
+            ++mGeneration;
+        }
+        mHasJob.notify_all();
+
+        process();
+
+        std::exception_ptr exception;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mJobDone.wait(lock, [&] { return mBusy == 0; });
+            mFunction = nullptr;
+            std::swap(exception, mException);
+        }
+
+        if (exception != nullptr)
+            std::rethrow_exception(exception);
+    }
+
+    void WorkerPool::process()
+    {
+        for (std::size_t i = mNext++; i < mCount; i = mNext++)
+        {
+            try
+            {
+                (*mFunction)(i);
+            }
+            catch (...)
+            {
+                const std::lock_guard<std::mutex> lock(mMutex);
+                if (mException == nullptr)
+                    mException = std::current_exception();
+                mNext = mCount;
+            }
+        }
+    }
+
+    void WorkerPool::run()
+    {
+        std::size_t generation = 0;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mHasJob.wait(lock, [&] { return mDone || mGeneration != generation; });
+                if (mDone)
+                    return;
+                generation = mGeneration;
+            }
+
+            process();
+
+            const std::lock_guard<std::mutex> lock(mMutex);
+            if (--mBusy == 0)
+                mJobDone.notify_all();
+        }
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef OPENMW_COMPONENTS_MISC_WORKERPOOL_H
+#define OPENMW_COMPONENTS_MISC_WORKERPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Misc
+{
+    /// Persistent threads to call a function for a range of indices. Unlike parallelFor threads are started once
+    /// and reused by each call, so it's suitable for work done every frame.
+    class WorkerPool
+    {
+    public:
+        /// threadsCount includes the calling thread, so 1 means no additional threads.
+        explicit WorkerPool(std::size_t threadsCount);
+
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool&) = delete;
+
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        std::size_t getThreadsCount() const { return mThreads.size() + 1; }
+
+        /// Call function for each index in [0, count) using the pool threads and the calling one. Returns when all
+        /// calls are finished. First thrown exception is rethrown after that. Not reentrant.
+        void parallelFor(std::size_t count, const std::function<void(std::size_t)>& function);
+
+    private:
+        std::mutex mMutex;
+        std::condition_variable mHasJob;
+        std::condition_variable mJobDone;
+        const std::function<void(std::size_t)>* mFunction = nullptr;
+        std::size_t mCount = 0;
+        std::atomic_size_t mNext {0};
+        std::size_t mGeneration = 0;
+        std::size_t mBusy = 0;
+        bool mDone = false;
+        std::exception_ptr mException;
+        std::vector<std::thread> mThreads;
+
+        void process();
+
+        void run();
+    };
+}
+
+#endif
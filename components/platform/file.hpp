@@ -29,6 +29,12 @@ namespace Platform::File {
 
     size_t read(Handle handle, void* data, size_t size);
 
+    /// Map the first @a size bytes of the file read-only into memory.
+    /// @note The mapping stays valid after the handle is closed, until unmap() is called.
+    const char* map(Handle handle, size_t size);
+
+    void unmap(const char* data, size_t size);
+
     class ScopedHandle
     {
         Handle mHandle{ Handle::Invalid };
@@ -59,6 +65,44 @@ namespace Platform::File {
 
         operator Handle() const { return mHandle; }
     };
+
+    class ScopedMapping
+    {
+        const char* mData = nullptr;
+        size_t mSize = 0;
+
+    public:
+        ScopedMapping() noexcept = default;
+        ScopedMapping(const ScopedMapping& other) = delete;
+        ScopedMapping(const char* data, size_t size) noexcept : mData(data), mSize(size) {}
+        ScopedMapping(ScopedMapping&& other) noexcept
+            : mData(other.mData)
+            , mSize(other.mSize)
+        {
+            other.mData = nullptr;
+            other.mSize = 0;
+        }
+        ScopedMapping& operator=(const ScopedMapping& other) = delete;
+        ScopedMapping& operator=(ScopedMapping&& other) noexcept
+        {
+            if (mData != nullptr)
+                unmap(mData, mSize);
+            mData = other.mData;
+            mSize = other.mSize;
+            other.mData = nullptr;
+            other.mSize = 0;
+            return *this;
+        }
+        ~ScopedMapping()
+        {
+            if (mData != nullptr)
+                unmap(mData, mSize);
+        }
+
+        const char* data() const { return mData; }
+        size_t size() const { return mSize; }
+        explicit operator bool() const { return mData != nullptr; }
+    };
 }
 
 #endif // OPENMW_COMPONENTS_PLATFORM_FILE_HPP
@@ -3,6 +3,7 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <errno.h>
 #include <string.h>
 #include <stdexcept>
@@ -99,4 +100,21 @@ namespace Platform::File {
         return amount;
     }
 
+    const char* map(Handle handle, size_t size)
+    {
+        auto nativeHandle = getNativeHandle(handle);
+
+        void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, nativeHandle, 0);
+        if (data == MAP_FAILED)
+        {
+            throw std::runtime_error("An attempt to map " + std::to_string(size) + " bytes failed: " + strerror(errno));
+        }
+        return static_cast<const char*>(data);
+    }
+
+    void unmap(const char* data, size_t size)
+    {
+        ::munmap(const_cast<char*>(data), size);
+    }
+
 }
@@ -5,6 +5,7 @@
 #include <string>
 #include <stdexcept>
 #include <cassert>
+#include <memory>
 
 namespace Platform::File {
 
@@ -88,4 +89,25 @@ namespace Platform::File {
         return static_cast<size_t>(amount);
     }
 
+    const char* map(Handle handle, size_t size)
+    {
+        // There is no portable way to map a file, read it into memory instead
+        auto data = std::make_unique<char[]>(size);
+        seek(handle, 0);
+        size_t got = 0;
+        while (got < size)
+        {
+            const size_t amount = read(handle, data.get() + got, size - got);
+            if (amount == 0)
+                throw std::runtime_error("An attempt to read " + std::to_string(size) + " bytes failed: unexpected end of file");
+            got += amount;
+        }
+        return data.release();
+    }
+
+    void unmap(const char* data, size_t /*size*/)
+    {
+        delete[] data;
+    }
+
 }
@@ -0,0 +1,436 @@
+#include "bulletshapediskcache.hpp"
+
+#include <BulletCollision/CollisionShapes/btBoxShape.h>
+#include <BulletCollision/CollisionShapes/btCompoundShape.h>
+#include <BulletCollision/CollisionShapes/btOptimizedBvh.h>
+#include <BulletCollision/CollisionShapes/btTriangleMesh.h>
+#include <LinearMath/btAlignedAllocator.h>
+#include <LinearMath/btScalar.h>
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <tuple>
+
+namespace Resource
+{
+    namespace
+    {
+        constexpr char sMagic[8] = {'O', 'M', 'W', 'S', 'H', 'A', 'P', 'E'};
+
+        // Increase when NifBullet::BulletNifLoader output for the same NIF file or the format changes
+        constexpr std::uint32_t sFormatVersion = 1;
+
+        // Limits sizes read from a broken file
+        constexpr std::uint64_t sMaxSize = std::numeric_limits<int>::max();
+
+        enum class ShapeType : std::uint8_t
+        {
+            None = 0,
+            TriangleMesh = 1,
+            Compound = 2,
+            Box = 3,
+        };
+
+        struct AlignedFree
+        {
+            void operator()(void* ptr) const { btAlignedFree(ptr); }
+        };
+
+        // Serialized BVH requires 16 bytes aligned buffer
+        using BvhBuffer = std::unique_ptr<void, AlignedFree>;
+
+        BvhBuffer makeBvhBuffer(std::size_t size)
+        {
+            BvhBuffer result(btAlignedAlloc(size, 16));
+            if (result == nullptr)
+                throw std::bad_alloc();
+            return result;
+        }
+
+        // BVH is deserialized in place and points into the buffer, so the shape owns the buffer
+        class CachedTriangleMeshShape : public TriangleMeshShape
+        {
+        public:
+            CachedTriangleMeshShape(std::unique_ptr<btTriangleMesh> mesh, bool useQuantizedAabbCompression,
+                    BvhBuffer&& bvhBuffer, btOptimizedBvh* bvh, const btVector3& scaling)
+                : TriangleMeshShape(mesh.release(), useQuantizedAabbCompression, false)
+                , mBvhBuffer(std::move(bvhBuffer))
+            {
+                setOptimizedBvh(bvh, scaling);
+            }
+
+            ~CachedTriangleMeshShape() override
+            {
+                m_bvh->~btOptimizedBvh();
+            }
+
+        private:
+            BvhBuffer mBvhBuffer;
+        };
+
+        template <class T>
+        void writeValue(std::ostream& stream, const T& value)
+        {
+            stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        void readData(std::istream& stream, char* data, std::size_t size)
+        {
+            if (!stream.read(data, static_cast<std::streamsize>(size)))
+                throw std::runtime_error("unexpected end of data");
+        }
+
+        template <class T>
+        T readValue(std::istream& stream)
+        {
+            T value;
+            readData(stream, reinterpret_cast<char*>(&value), sizeof(value));
+            return value;
+        }
+
+        std::size_t readSize(std::istream& stream)
+        {
+            const std::uint64_t value = readValue<std::uint64_t>(stream);
+            if (value > sMaxSize)
+                throw std::runtime_error("invalid size: " + std::to_string(value));
+            return static_cast<std::size_t>(value);
+        }
+
+        void writeVector(std::ostream& stream, const btVector3& value)
+        {
+            for (int i = 0; i < 3; ++i)
+                writeValue(stream, value[i]);
+        }
+
+        btVector3 readVector(std::istream& stream)
+        {
+            const btScalar x = readValue<btScalar>(stream);
+            const btScalar y = readValue<btScalar>(stream);
+            const btScalar z = readValue<btScalar>(stream);
+            return btVector3(x, y, z);
+        }
+
+        void writeVector(std::ostream& stream, const osg::Vec3f& value)
+        {
+            for (int i = 0; i < 3; ++i)
+                writeValue(stream, value[i]);
+        }
+
+        osg::Vec3f readVec3f(std::istream& stream)
+        {
+            osg::Vec3f result;
+            for (int i = 0; i < 3; ++i)
+                result[i] = readValue<float>(stream);
+            return result;
+        }
+
+        void writeTransform(std::ostream& stream, const btTransform& value)
+        {
+            for (int i = 0; i < 3; ++i)
+                writeVector(stream, value.getBasis()[i]);
+            writeVector(stream, value.getOrigin());
+        }
+
+        btTransform readTransform(std::istream& stream)
+        {
+            btMatrix3x3 basis;
+            for (int i = 0; i < 3; ++i)
+                basis[i] = readVector(stream);
+            const btVector3 origin = readVector(stream);
+            return btTransform(basis, origin);
+        }
+
+        bool isUnitScaling(const btCollisionShape& shape)
+        {
+            return shape.getLocalScaling() == btVector3(1, 1, 1);
+        }
+
+        void writeShape(std::ostream& stream, const btCollisionShape* shape);
+
+        void writeTriangleMesh(std::ostream& stream, const btBvhTriangleMeshShape& shape)
+        {
+            const btTriangleMesh* const mesh = dynamic_cast<const btTriangleMesh*>(shape.getMeshInterface());
+            if (mesh == nullptr || mesh->getNumSubParts() != 1 || shape.getTriangleInfoMap() != nullptr)
+                throw std::runtime_error("unsupported triangle mesh shape");
+
+            const btOptimizedBvh* const bvh = const_cast<btBvhTriangleMeshShape&>(shape).getOptimizedBvh();
+            if (bvh == nullptr)
+                throw std::runtime_error("triangle mesh shape has no bvh");
+
+            writeValue(stream, static_cast<std::uint8_t>(mesh->getUse32bitIndices()));
+            writeValue(stream, static_cast<std::uint8_t>(mesh->getUse4componentVertices()));
+            writeValue(stream, static_cast<std::uint8_t>(shape.usesQuantizedAabbCompression()));
+            writeVector(stream, shape.getLocalScaling());
+
+            const unsigned char* vertexBase = nullptr;
+            int numVertices = 0;
+            PHY_ScalarType vertexType = PHY_FLOAT;
+            int vertexStride = 0;
+            const unsigned char* indexBase = nullptr;
+            int indexStride = 0;
+            int numTriangles = 0;
+            PHY_ScalarType indexType = PHY_INTEGER;
+            mesh->getLockedReadOnlyVertexIndexBase(&vertexBase, numVertices, vertexType, vertexStride, &indexBase,
+                indexStride, numTriangles, indexType);
+
+            writeValue(stream, static_cast<std::uint64_t>(numVertices));
+            for (int i = 0; i < numVertices; ++i)
+            {
+                const unsigned char* const vertex = vertexBase + static_cast<std::ptrdiff_t>(i) * vertexStride;
+                if (vertexType == PHY_FLOAT)
+                {
+                    const float* const value = reinterpret_cast<const float*>(vertex);
+                    writeVector(stream, btVector3(value[0], value[1], value[2]));
+                }
+                else if (vertexType == PHY_DOUBLE)
+                {
+                    const double* const value = reinterpret_cast<const double*>(vertex);
+                    writeVector(stream, btVector3(value[0], value[1], value[2]));
+                }
+                else
+                    throw std::runtime_error("unsupported vertex type: " + std::to_string(vertexType));
+            }
+
+            writeValue(stream, static_cast<std::uint64_t>(numTriangles));
+            for (int i = 0; i < numTriangles; ++i)
+            {
+                const unsigned char* const triangle = indexBase + static_cast<std::ptrdiff_t>(i) * indexStride;
+                for (int j = 0; j < 3; ++j)
+                {
+                    if (indexType == PHY_INTEGER)
+                        writeValue(stream, static_cast<std::uint32_t>(reinterpret_cast<const unsigned int*>(triangle)[j]));
+                    else if (indexType == PHY_SHORT)
+                        writeValue(stream, static_cast<std::uint32_t>(reinterpret_cast<const unsigned short*>(triangle)[j]));
+                    else
+                        throw std::runtime_error("unsupported index type: " + std::to_string(indexType));
+                }
+            }
+
+            mesh->unLockReadOnlyVertexBase(0);
+
+            const unsigned bvhSize = bvh->calculateSerializeBufferSize();
+            const BvhBuffer bvhBuffer = makeBvhBuffer(bvhSize);
+            if (!bvh->serializeInPlace(bvhBuffer.get(), bvhSize, false))
+                throw std::runtime_error("failed to serialize bvh");
+            writeValue(stream, static_cast<std::uint64_t>(bvhSize));
+            stream.write(static_cast<const char*>(bvhBuffer.get()), bvhSize);
+        }
+
+        CollisionShapePtr readTriangleMesh(std::istream& stream)
+        {
+            const bool use32bitIndices = readValue<std::uint8_t>(stream) != 0;
+            const bool use4componentVertices = readValue<std::uint8_t>(stream) != 0;
+            const bool useQuantizedAabbCompression = readValue<std::uint8_t>(stream) != 0;
+            const btVector3 scaling = readVector(stream);
+
+            auto mesh = std::make_unique<btTriangleMesh>(use32bitIndices, use4componentVertices);
+
+            const std::size_t numVertices = readSize(stream);
+            mesh->preallocateVertices(static_cast<int>(numVertices));
+            for (std::size_t i = 0; i < numVertices; ++i)
+                mesh->findOrAddVertex(readVector(stream), false);
+
+            const std::size_t numTriangles = readSize(stream);
+            if (numTriangles > sMaxSize / 3)
+                throw std::runtime_error("invalid number of triangles: " + std::to_string(numTriangles));
+            mesh->preallocateIndices(static_cast<int>(numTriangles * 3));
+            for (std::size_t i = 0; i < numTriangles; ++i)
+            {
+                for (int j = 0; j < 3; ++j)
+                {
+                    const std::uint32_t index = readValue<std::uint32_t>(stream);
+                    if (index >= numVertices)
+                        throw std::runtime_error("invalid vertex index: " + std::to_string(index));
+                    mesh->addIndex(static_cast<int>(index));
+                }
+                ++mesh->getIndexedMeshArray()[0].m_numTriangles;
+            }
+
+            const std::size_t bvhSize = readSize(stream);
+            // Deserialization reads the tree header without checking the buffer size
+            if (bvhSize < sizeof(btQuantizedBvh))
+                throw std::runtime_error("invalid bvh size: " + std::to_string(bvhSize));
+            BvhBuffer bvhBuffer = makeBvhBuffer(bvhSize);
+            readData(stream, static_cast<char*>(bvhBuffer.get()), bvhSize);
+            btOptimizedBvh* const bvh = btOptimizedBvh::deSerializeInPlace(bvhBuffer.get(),
+                static_cast<unsigned>(bvhSize), false);
+            if (bvh == nullptr)
+                throw std::runtime_error("failed to deserialize bvh");
+
+            return CollisionShapePtr(new CachedTriangleMeshShape(std::move(mesh), useQuantizedAabbCompression,
+                std::move(bvhBuffer), bvh, scaling));
+        }
+
+        void writeCompound(std::ostream& stream, const btCompoundShape& shape)
+        {
+            if (!isUnitScaling(shape))
+                throw std::runtime_error("unsupported scaled compound shape");
+            writeValue(stream, static_cast<std::uint64_t>(shape.getNumChildShapes()));
+            for (int i = 0, n = shape.getNumChildShapes(); i < n; ++i)
+            {
+                writeTransform(stream, shape.getChildTransform(i));
+                writeShape(stream, shape.getChildShape(i));
+            }
+        }
+
+        CollisionShapePtr readShape(std::istream& stream);
+
+        CollisionShapePtr readCompound(std::istream& stream)
+        {
+            btCompoundShape* const compound = new btCompoundShape;
+            CollisionShapePtr result(compound);
+            const std::size_t numChildren = readSize(stream);
+            for (std::size_t i = 0; i < numChildren; ++i)
+            {
+                const btTransform transform = readTransform(stream);
+                CollisionShapePtr child = readShape(stream);
+                if (child == nullptr)
+                    throw std::runtime_error("compound shape has empty child");
+                compound->addChildShape(transform, child.get());
+                std::ignore = child.release();
+            }
+            return result;
+        }
+
+        void writeBox(std::ostream& stream, const btBoxShape& shape)
+        {
+            if (!isUnitScaling(shape))
+                throw std::runtime_error("unsupported scaled box shape");
+            writeVector(stream, shape.getHalfExtentsWithMargin());
+            writeValue(stream, shape.getMargin());
+        }
+
+        CollisionShapePtr readBox(std::istream& stream)
+        {
+            const btVector3 halfExtents = readVector(stream);
+            const btScalar margin = readValue<btScalar>(stream);
+            auto result = std::make_unique<btBoxShape>(halfExtents);
+            result->setMargin(margin);
+            return CollisionShapePtr(result.release());
+        }
+
+        void writeShape(std::ostream& stream, const btCollisionShape* shape)
+        {
+            if (shape == nullptr)
+            {
+                writeValue(stream, ShapeType::None);
+                return;
+            }
+
+            switch (shape->getShapeType())
+            {
+                case TRIANGLE_MESH_SHAPE_PROXYTYPE:
+                    writeValue(stream, ShapeType::TriangleMesh);
+                    writeTriangleMesh(stream, static_cast<const btBvhTriangleMeshShape&>(*shape));
+                    return;
+                case COMPOUND_SHAPE_PROXYTYPE:
+                    writeValue(stream, ShapeType::Compound);
+                    writeCompound(stream, static_cast<const btCompoundShape&>(*shape));
+                    return;
+                case BOX_SHAPE_PROXYTYPE:
+                    writeValue(stream, ShapeType::Box);
+                    writeBox(stream, static_cast<const btBoxShape&>(*shape));
+                    return;
+            }
+
+            throw std::runtime_error(std::string("unsupported collision shape: ") + shape->getName());
+        }
+
+        CollisionShapePtr readShape(std::istream& stream)
+        {
+            const ShapeType type = readValue<ShapeType>(stream);
+            switch (type)
+            {
+                case ShapeType::None:
+                    return nullptr;
+                case ShapeType::TriangleMesh:
+                    return readTriangleMesh(stream);
+                case ShapeType::Compound:
+                    return readCompound(stream);
+                case ShapeType::Box:
+                    return readBox(stream);
+            }
+
+            throw std::runtime_error("invalid collision shape type: " + std::to_string(static_cast<int>(type)));
+        }
+    }
+
+    void writeBulletShape(const BulletShape& shape, std::ostream& stream)
+    {
+        stream.write(sMagic, sizeof(sMagic));
+        writeValue(stream, sFormatVersion);
+        writeValue(stream, static_cast<std::uint32_t>(BT_BULLET_VERSION));
+        writeValue(stream, static_cast<std::uint32_t>(sizeof(btScalar)));
+
+        writeValue(stream, static_cast<std::uint64_t>(shape.mFileHash.size()));
+        stream.write(shape.mFileHash.data(), static_cast<std::streamsize>(shape.mFileHash.size()));
+        writeVector(stream, shape.mCollisionBox.mExtents);
+        writeVector(stream, shape.mCollisionBox.mCenter);
+        writeValue(stream, static_cast<std::uint32_t>(shape.mCollisionType));
+        writeValue(stream, static_cast<std::uint64_t>(shape.mAnimatedShapes.size()));
+        for (const auto& [recIndex, childIndex] : shape.mAnimatedShapes)
+        {
+            writeValue(stream, static_cast<std::int32_t>(recIndex));
+            writeValue(stream, static_cast<std::int32_t>(childIndex));
+        }
+
+        writeShape(stream, shape.mCollisionShape.get());
+        writeShape(stream, shape.mAvoidCollisionShape.get());
+    }
+
+    osg::ref_ptr<BulletShape> readBulletShape(std::istream& stream)
+    {
+        char magic[sizeof(sMagic)];
+        readData(stream, magic, sizeof(magic));
+        if (std::memcmp(magic, sMagic, sizeof(magic)) != 0)
+            throw std::runtime_error("invalid magic");
+        if (readValue<std::uint32_t>(stream) != sFormatVersion)
+            throw std::runtime_error("unsupported format version");
+        if (readValue<std::uint32_t>(stream) != static_cast<std::uint32_t>(BT_BULLET_VERSION))
+            throw std::runtime_error("written by different Bullet version");
+        if (readValue<std::uint32_t>(stream) != static_cast<std::uint32_t>(sizeof(btScalar)))
+            throw std::runtime_error("written by Bullet with different precision");
+
+        osg::ref_ptr<BulletShape> result(new BulletShape);
+        result->mFileHash.resize(readSize(stream));
+        readData(stream, result->mFileHash.data(), result->mFileHash.size());
+        result->mCollisionBox.mExtents = readVec3f(stream);
+        result->mCollisionBox.mCenter = readVec3f(stream);
+        result->mCollisionType = readValue<std::uint32_t>(stream);
+        const std::size_t numAnimatedShapes = readSize(stream);
+        for (std::size_t i = 0; i < numAnimatedShapes; ++i)
+        {
+            const std::int32_t recIndex = readValue<std::int32_t>(stream);
+            const std::int32_t childIndex = readValue<std::int32_t>(stream);
+            result->mAnimatedShapes.emplace(recIndex, childIndex);
+        }
+
+        result->mCollisionShape = readShape(stream);
+        result->mAvoidCollisionShape = readShape(stream);
+
+        return result;
+    }
+
+    BulletShapeDiskCache::BulletShapeDiskCache(const std::filesystem::path& path)
+        : mFiles(path, "collision shape")
+    {
+    }
+
+    std::string BulletShapeDiskCache::getFileNameSuffix()
+    {
+        return "-" + std::to_string(sFormatVersion) + ".shape";
+    }
+
+    osg::ref_ptr<BulletShape> BulletShapeDiskCache::read(const std::string& normalizedFilename, std::istream& stream)
+    {
+        stream.exceptions(std::ios::failbit | std::ios::badbit);
+        osg::ref_ptr<BulletShape> shape = readBulletShape(stream);
+        shape->mFileName = normalizedFilename;
+        return shape;
+    }
+}
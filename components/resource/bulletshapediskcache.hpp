@@ -0,0 +1,53 @@
+#ifndef OPENMW_COMPONENTS_RESOURCE_BULLETSHAPEDISKCACHE_H
+#define OPENMW_COMPONENTS_RESOURCE_BULLETSHAPEDISKCACHE_H
+
+#include "bulletshape.hpp"
+#include "diskcache.hpp"
+
+#include <osg/ref_ptr>
+
+#include <filesystem>
+#include <iosfwd>
+#include <string>
+#include <utility>
+
+namespace Resource
+{
+    /// Write collision shapes of the BulletShape with their built BVH trees, so reading doesn't require to build them again.
+    /// File name is not written.
+    /// @throw std::runtime_error if shape contains collision shapes not produced by NifBullet::BulletNifLoader
+    void writeBulletShape(const BulletShape& shape, std::ostream& stream);
+
+    /// @throw std::runtime_error if stream has invalid data or data written by a different version
+    osg::ref_ptr<BulletShape> readBulletShape(std::istream& stream);
+
+    /// @brief Stores BulletShapes loaded from NIF files to not build the same collision shapes in later sessions.
+    /// Files are named by the hash of NIF file content and a version increased on any NifBullet::BulletNifLoader change.
+    /// @note Thread safe.
+    class BulletShapeDiskCache
+    {
+    public:
+        explicit BulletShapeDiskCache(const std::filesystem::path& path);
+
+        /// @param stream content of the NIF file, used to make the cache key.
+        /// @param load loads the shape from the NIF file when there is no cached one, the result is stored.
+        template <class Load>
+        osg::ref_ptr<BulletShape> getOrLoad(const std::string& normalizedFilename, std::istream& stream, Load&& load)
+        {
+            return mFiles.getOrLoad(normalizedFilename, stream, getFileNameSuffix(),
+                [&] (std::istream& file) { return read(normalizedFilename, file); }, std::forward<Load>(load),
+                [] (const BulletShape& shape, std::ostream& file) { writeBulletShape(shape, file); return true; });
+        }
+
+        DiskCache::Stats getStats() const { return mFiles.getStats(); }
+
+    private:
+        DiskCache mFiles;
+
+        static std::string getFileNameSuffix();
+
+        static osg::ref_ptr<BulletShape> read(const std::string& normalizedFilename, std::istream& stream);
+    };
+}
+
+#endif
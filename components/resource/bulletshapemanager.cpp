@@ -17,6 +17,7 @@
 #include <components/nifbullet/bulletnifloader.hpp>
 
 #include "bulletshape.hpp"
+#include "bulletshapediskcache.hpp"
 #include "scenemanager.hpp"
 #include "niffilemanager.hpp"
 #include "objectcache.hpp"
@@ -119,65 +120,81 @@ BulletShapeManager::~BulletShapeManager()
 
 }
 
+void BulletShapeManager::setDiskCachePath(const std::filesystem::path& path)
+{
+    if (path.empty())
+        mDiskCache = nullptr;
+    else
+        mDiskCache = std::make_unique<BulletShapeDiskCache>(path);
+}
+
 osg::ref_ptr<const BulletShape> BulletShapeManager::getShape(const std::string &name)
 {
     const std::string normalized = mVFS->normalizeFilename(name);
 
+    osg::ref_ptr<osg::Object> obj = mCache->getOrLoad(normalized, [&] { return loadShape(normalized); });
+    return osg::ref_ptr<BulletShape>(static_cast<BulletShape*>(obj.get()));
+}
+
+osg::ref_ptr<BulletShape> BulletShapeManager::loadShape(const std::string& normalized)
+{
     osg::ref_ptr<BulletShape> shape;
-    osg::ref_ptr<osg::Object> obj = mCache->getRefFromObjectCache(normalized);
-    if (obj)
-        shape = osg::ref_ptr<BulletShape>(static_cast<BulletShape*>(obj.get()));
+    if (Misc::getFileExtension(normalized) == "nif")
+    {
+        if (mDiskCache != nullptr)
+            shape = mDiskCache->getOrLoad(normalized, *mVFS->get(normalized), [&] { return loadNifShape(normalized); });
+        else
+            shape = loadNifShape(normalized);
+    }
     else
     {
-        if (Misc::getFileExtension(normalized) == "nif")
+        // TODO: support .bullet shape files
+
+        osg::ref_ptr<const osg::Node> constNode (mSceneManager->getTemplate(normalized));
+        osg::ref_ptr<osg::Node> node (const_cast<osg::Node*>(constNode.get())); // const-trickery required because there is no const version of NodeVisitor
+
+        // Check first if there's a custom collision node
+        unsigned int visitAllNodesMask = 0xffffffff;
+        SceneUtil::FindByNameVisitor nameFinder("Collision");
+        nameFinder.setTraversalMask(visitAllNodesMask);
+        nameFinder.setNodeMaskOverride(visitAllNodesMask);
+        node->accept(nameFinder);
+        if (nameFinder.mFoundNode)
         {
-            NifBullet::BulletNifLoader loader;
-            shape = loader.load(*mNifFileManager->get(normalized));
+            NodeToShapeVisitor visitor;
+            visitor.setTraversalMask(visitAllNodesMask);
+            visitor.setNodeMaskOverride(visitAllNodesMask);
+            nameFinder.mFoundNode->accept(visitor);
+            shape = visitor.getShape();
         }
-        else
+
+        // Generate a collision shape from the mesh
+        if (!shape)
         {
-            // TODO: support .bullet shape files
-
-            osg::ref_ptr<const osg::Node> constNode (mSceneManager->getTemplate(normalized));
-            osg::ref_ptr<osg::Node> node (const_cast<osg::Node*>(constNode.get())); // const-trickery required because there is no const version of NodeVisitor
-
-            // Check first if there's a custom collision node
-            unsigned int visitAllNodesMask = 0xffffffff;
-            SceneUtil::FindByNameVisitor nameFinder("Collision");
-            nameFinder.setTraversalMask(visitAllNodesMask);
-            nameFinder.setNodeMaskOverride(visitAllNodesMask);
-            node->accept(nameFinder);
-            if (nameFinder.mFoundNode)
-            {
-                NodeToShapeVisitor visitor;
-                visitor.setTraversalMask(visitAllNodesMask);
-                visitor.setNodeMaskOverride(visitAllNodesMask);
-                nameFinder.mFoundNode->accept(visitor);
-                shape = visitor.getShape();
-            }
-
-            // Generate a collision shape from the mesh
+            NodeToShapeVisitor visitor;
+            node->accept(visitor);
+            shape = visitor.getShape();
             if (!shape)
-            {
-                NodeToShapeVisitor visitor;
-                node->accept(visitor);
-                shape = visitor.getShape();
-                if (!shape)
-                    return osg::ref_ptr<BulletShape>();
-            }
-
-            if (shape != nullptr)
-            {
-                shape->mFileName = normalized;
-                constNode->getUserValue(Misc::OsgUserValues::sFileHash, shape->mFileHash);
-            }
+                return osg::ref_ptr<BulletShape>();
         }
 
-        mCache->addEntryToObjectCache(normalized, shape);
+        if (shape != nullptr)
+        {
+            shape->mFileName = normalized;
+            constNode->getUserValue(Misc::OsgUserValues::sFileHash, shape->mFileHash);
+        }
     }
+
+    mCache->addEntryToObjectCache(normalized, shape);
     return shape;
 }
 
+osg::ref_ptr<BulletShape> BulletShapeManager::loadNifShape(const std::string& normalized)
+{
+    NifBullet::BulletNifLoader loader;
+    return loader.load(*mNifFileManager->get(normalized));
+}
+
 osg::ref_ptr<BulletShapeInstance> BulletShapeManager::cacheInstance(const std::string &name)
 {
     const std::string normalized = mVFS->normalizeFilename(name);
@@ -224,7 +241,15 @@ void BulletShapeManager::clearCache()
 void BulletShapeManager::reportStats(unsigned int frameNumber, osg::Stats *stats) const
 {
     stats->setAttribute(frameNumber, "Shape", mCache->getCacheSize());
+    stats->setAttribute(frameNumber, "Shape Shared Loads", mCache->getSharedLoadsCount());
     stats->setAttribute(frameNumber, "Shape Instance", mInstanceCache->getCacheSize());
+
+    if (mDiskCache != nullptr)
+    {
+        const DiskCache::Stats diskCacheStats = mDiskCache->getStats();
+        stats->setAttribute(frameNumber, "Shape Disk Cache Hits", diskCacheStats.mHits);
+        stats->setAttribute(frameNumber, "Shape Disk Cache Misses", diskCacheStats.mMisses);
+    }
 }
 
 }
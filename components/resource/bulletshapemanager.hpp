@@ -1,7 +1,9 @@
 #ifndef OPENMW_COMPONENTS_BULLETSHAPEMANAGER_H
 #define OPENMW_COMPONENTS_BULLETSHAPEMANAGER_H
 
+#include <filesystem>
 #include <map>
+#include <memory>
 #include <string>
 
 #include <osg/ref_ptr>
@@ -18,6 +20,7 @@ namespace Resource
     class BulletShapeInstance;
 
     class MultiObjectCache;
+    class BulletShapeDiskCache;
 
     /// Handles loading, caching and "instancing" of bullet shapes.
     /// A shape 'instance' is a clone of another shape, with the goal of setting a different scale on this instance.
@@ -28,6 +31,11 @@ namespace Resource
         BulletShapeManager(const VFS::Manager* vfs, SceneManager* sceneMgr, NifFileManager* nifFileManager);
         ~BulletShapeManager();
 
+        /// Store shapes loaded from NIF files in the given directory and reuse them in later sessions instead of
+        /// building the same collision shapes again. Empty path disables the cache.
+        /// @note Not thread safe, should be called before loading any shapes.
+        void setDiskCachePath(const std::filesystem::path& path);
+
         /// @note May return a null pointer if the object has no shape.
         osg::ref_ptr<const BulletShape> getShape(const std::string& name);
 
@@ -49,7 +57,12 @@ namespace Resource
     private:
         osg::ref_ptr<BulletShapeInstance> createInstance(const std::string& name);
 
+        osg::ref_ptr<BulletShape> loadShape(const std::string& normalized);
+
+        osg::ref_ptr<BulletShape> loadNifShape(const std::string& normalized);
+
         osg::ref_ptr<MultiObjectCache> mInstanceCache;
+        std::unique_ptr<BulletShapeDiskCache> mDiskCache;
         SceneManager* mSceneManager;
         NifFileManager* mNifFileManager;
     };
@@ -0,0 +1,92 @@
+#include "diskcache.hpp"
+
+#include <components/debug/debuglog.hpp>
+
+#include <components/files/hash.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+namespace Resource
+{
+    DiskCache::DiskCache(const std::filesystem::path& path, std::string_view description)
+        : mPath(path)
+        , mDescription(description)
+    {
+    }
+
+    DiskCache::Stats DiskCache::getStats() const
+    {
+        Stats result;
+        result.mHits = mHits.load();
+        result.mMisses = mMisses.load();
+        return result;
+    }
+
+    std::filesystem::path DiskCache::getFilePath(const std::string& normalizedFilename, std::istream& stream,
+        std::string_view suffix) const
+    {
+        const std::array<std::uint64_t, 2> hash = Files::getHash(normalizedFilename, stream);
+        char name[33];
+        std::snprintf(name, sizeof(name), "%016llx%016llx", static_cast<unsigned long long>(hash[0]),
+            static_cast<unsigned long long>(hash[1]));
+        std::string fileName(name);
+        fileName += suffix;
+        return mPath / fileName;
+    }
+
+    bool DiskCache::readFile(const std::string& normalizedFilename, const std::filesystem::path& path,
+        const std::function<bool(std::istream&)>& read) const
+    {
+        std::ifstream stream(path, std::ios::binary);
+        if (!stream.is_open())
+            return false;
+
+        try
+        {
+            if (!read(stream))
+                return false;
+            Log(Debug::Verbose) << "Using cached " << mDescription << ' ' << path << " for " << normalizedFilename;
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to read cached " << mDescription << ' ' << path << " for "
+                << normalizedFilename << ": " << e.what();
+            return false;
+        }
+    }
+
+    void DiskCache::writeFile(const std::string& normalizedFilename, const std::filesystem::path& path,
+        const std::function<bool(std::ostream&)>& write) const
+    {
+        // Same file can be written concurrently when different files have the same content
+        std::filesystem::path tmpPath = path;
+        tmpPath += "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+
+        try
+        {
+            std::filesystem::create_directories(path.parent_path());
+
+            std::ofstream stream(tmpPath, std::ios::binary);
+            stream.exceptions(std::ios::failbit | std::ios::badbit);
+            const bool written = write(stream);
+            stream.close();
+
+            if (written)
+                std::filesystem::rename(tmpPath, path);
+            else
+                std::filesystem::remove(tmpPath);
+        }
+        catch (const std::exception& e)
+        {
+            std::error_code ec;
+            std::filesystem::remove(tmpPath, ec);
+            Log(Debug::Warning) << "Failed to write cached " << mDescription << ' ' << path << " for "
+                << normalizedFilename << ": " << e.what();
+        }
+    }
+}
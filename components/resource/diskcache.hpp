@@ -0,0 +1,72 @@
+#ifndef OPENMW_COMPONENTS_RESOURCE_DISKCACHE_H
+#define OPENMW_COMPONENTS_RESOURCE_DISKCACHE_H
+
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+namespace Resource
+{
+    /// @brief Stores objects converted from files in a directory to not convert the same files in later sessions.
+    /// Files are named by the hash of the source file content and a suffix for everything else the result depends on.
+    /// They are written into a temporary file renamed when complete, so a partially written file is never read.
+    /// @note Thread safe.
+    class DiskCache
+    {
+    public:
+        struct Stats
+        {
+            std::size_t mHits = 0;
+            std::size_t mMisses = 0;
+        };
+
+        /// @param description names cached objects in log messages.
+        DiskCache(const std::filesystem::path& path, std::string_view description);
+
+        /// @param stream content of the source file, used to make the cache key.
+        /// @param suffix is appended to the file name, should include everything else the result depends on.
+        /// @param read reads cached object from the stream, may throw or return nullptr to ignore the file.
+        /// @param load converts the source file when there is no cached object.
+        /// @param write writes loaded object to the stream, may throw or return false to not store it.
+        template <class Read, class Load, class Write>
+        auto getOrLoad(const std::string& normalizedFilename, std::istream& stream, std::string_view suffix,
+            Read&& read, Load&& load, Write&& write)
+        {
+            const std::filesystem::path path = getFilePath(normalizedFilename, stream, suffix);
+            decltype(load()) cached;
+            if (readFile(normalizedFilename, path, [&] (std::istream& file) { cached = read(file); return cached != nullptr; }))
+            {
+                ++mHits;
+                return cached;
+            }
+            ++mMisses;
+            decltype(load()) loaded = load();
+            if (loaded != nullptr)
+                writeFile(normalizedFilename, path, [&] (std::ostream& file) { return write(*loaded, file); });
+            return loaded;
+        }
+
+        Stats getStats() const;
+
+    private:
+        const std::filesystem::path mPath;
+        const std::string mDescription;
+        std::atomic_size_t mHits {0};
+        std::atomic_size_t mMisses {0};
+
+        std::filesystem::path getFilePath(const std::string& normalizedFilename, std::istream& stream,
+            std::string_view suffix) const;
+
+        bool readFile(const std::string& normalizedFilename, const std::filesystem::path& path,
+            const std::function<bool(std::istream&)>& read) const;
+
+        void writeFile(const std::string& normalizedFilename, const std::filesystem::path& path,
+            const std::function<bool(std::ostream&)>& write) const;
+    };
+}
+
+#endif
@@ -87,105 +87,107 @@ namespace Resource
     {
         const std::string normalized = mVFS->normalizeFilename(filename);
 
-        osg::ref_ptr<osg::Object> obj = mCache->getRefFromObjectCache(normalized);
-        if (obj)
-            return osg::ref_ptr<osg::Image>(static_cast<osg::Image*>(obj.get()));
-        else
+        osg::ref_ptr<osg::Object> obj = mCache->getOrLoad(normalized,
+            [&] { return loadImage(filename, normalized, disableFlip); });
+        return osg::ref_ptr<osg::Image>(static_cast<osg::Image*>(obj.get()));
+    }
+
+    osg::ref_ptr<osg::Image> ImageManager::loadImage(const std::string& filename, const std::string& normalized,
+        bool disableFlip)
+    {
+        Files::IStreamPtr stream;
+        try
         {
-            Files::IStreamPtr stream;
-            try
-            {
-                stream = mVFS->get(normalized);
-            }
-            catch (std::exception& e)
-            {
-                Log(Debug::Error) << "Failed to open image: " << e.what();
-                mCache->addEntryToObjectCache(normalized, mWarningImage);
-                return mWarningImage;
-            }
+            stream = mVFS->get(normalized);
+        }
+        catch (std::exception& e)
+        {
+            Log(Debug::Error) << "Failed to open image: " << e.what();
+            mCache->addEntryToObjectCache(normalized, mWarningImage);
+            return mWarningImage;
+        }
+
+        const std::string ext(Misc::getFileExtension(normalized));
+        osgDB::ReaderWriter* reader = osgDB::Registry::instance()->getReaderWriterForExtension(ext);
+        if (!reader)
+        {
+            Log(Debug::Error) << "Error loading " << filename << ": no readerwriter for '" << ext << "' found";
+            mCache->addEntryToObjectCache(normalized, mWarningImage);
+            return mWarningImage;
+        }
 
-            const std::string ext(Misc::getFileExtension(normalized));
-            osgDB::ReaderWriter* reader = osgDB::Registry::instance()->getReaderWriterForExtension(ext);
-            if (!reader)
+        bool killAlpha = false;
+        if (reader->supportedExtensions().count("tga"))
+        {
+            // Morrowind ignores the alpha channel of 16bpp TGA files even when the header says not to
+            unsigned char header[18];
+            stream->read((char*)header, 18);
+            if (stream->gcount() != 18)
             {
-                Log(Debug::Error) << "Error loading " << filename << ": no readerwriter for '" << ext << "' found";
+                Log(Debug::Error) << "Error loading " << filename << ": couldn't read TGA header";
                 mCache->addEntryToObjectCache(normalized, mWarningImage);
                 return mWarningImage;
             }
+            int type = header[2];
+            int depth;
+            if (type == 1 || type == 9)
+                depth = header[7];
+            else
+                depth = header[16];
+            int alphaBPP = header[17] & 0x0F;
+            killAlpha = depth == 16 && alphaBPP == 1;
+            stream->seekg(0);
+        }
 
-            bool killAlpha = false;
-            if (reader->supportedExtensions().count("tga"))
-            {
-                // Morrowind ignores the alpha channel of 16bpp TGA files even when the header says not to
-                unsigned char header[18];
-                stream->read((char*)header, 18);
-                if (stream->gcount() != 18)
-                {
-                    Log(Debug::Error) << "Error loading " << filename << ": couldn't read TGA header";
-                    mCache->addEntryToObjectCache(normalized, mWarningImage);
-                    return mWarningImage;
-                }
-                int type = header[2];
-                int depth;
-                if (type == 1 || type == 9)
-                    depth = header[7];
-                else
-                    depth = header[16];
-                int alphaBPP = header[17] & 0x0F;
-                killAlpha = depth == 16 && alphaBPP == 1;
-                stream->seekg(0);
-            }
+        osgDB::ReaderWriter::ReadResult result = reader->readImage(*stream, disableFlip ? mOptionsNoFlip : mOptions);
+        if (!result.success())
+        {
+            Log(Debug::Error) << "Error loading " << filename << ": " << result.message() << " code " << result.status();
+            mCache->addEntryToObjectCache(normalized, mWarningImage);
+            return mWarningImage;
+        }
+
+        osg::ref_ptr<osg::Image> image = result.getImage();
 
-            osgDB::ReaderWriter::ReadResult result = reader->readImage(*stream, disableFlip ? mOptionsNoFlip : mOptions);
-            if (!result.success())
+        image->setFileName(normalized);
+        if (!checkSupported(image, filename))
+        {
+            static bool uncompress = (getenv("OPENMW_DECOMPRESS_TEXTURES") != nullptr);
+            if (!uncompress)
             {
-                Log(Debug::Error) << "Error loading " << filename << ": " << result.message() << " code " << result.status();
+                Log(Debug::Error) << "Error loading " << filename << ": no S3TC texture compression support installed";
                 mCache->addEntryToObjectCache(normalized, mWarningImage);
                 return mWarningImage;
             }
-
-            osg::ref_ptr<osg::Image> image = result.getImage();
-
-            image->setFileName(normalized);
-            if (!checkSupported(image, filename))
-            {
-                static bool uncompress = (getenv("OPENMW_DECOMPRESS_TEXTURES") != nullptr);
-                if (!uncompress)
-                {
-                    Log(Debug::Error) << "Error loading " << filename << ": no S3TC texture compression support installed";
-                    mCache->addEntryToObjectCache(normalized, mWarningImage);
-                    return mWarningImage;
-                }
-                else
-                {
-                    // decompress texture in software if not supported by GPU
-                    // requires update to getColor() to be released with OSG 3.6
-                    osg::ref_ptr<osg::Image> newImage = new osg::Image;
-                    newImage->setFileName(image->getFileName());
-                    newImage->allocateImage(image->s(), image->t(), image->r(), image->isImageTranslucent() ? GL_RGBA : GL_RGB, GL_UNSIGNED_BYTE);
-                    for (int s=0; s<image->s(); ++s)
-                        for (int t=0; t<image->t(); ++t)
-                            for (int r=0; r<image->r(); ++r)
-                                newImage->setColor(image->getColor(s,t,r), s,t,r);
-                    image = newImage;
-                }
-            }
-            else if (killAlpha)
+            else
             {
+                // decompress texture in software if not supported by GPU
+                // requires update to getColor() to be released with OSG 3.6
                 osg::ref_ptr<osg::Image> newImage = new osg::Image;
                 newImage->setFileName(image->getFileName());
-                newImage->allocateImage(image->s(), image->t(), image->r(), GL_RGB, GL_UNSIGNED_BYTE);
-                // OSG just won't write the alpha as there's nowhere to put it.
-                for (int s = 0; s < image->s(); ++s)
-                    for (int t = 0; t < image->t(); ++t)
-                        for (int r = 0; r < image->r(); ++r)
-                            newImage->setColor(image->getColor(s, t, r), s, t, r);
+                newImage->allocateImage(image->s(), image->t(), image->r(), image->isImageTranslucent() ? GL_RGBA : GL_RGB, GL_UNSIGNED_BYTE);
+                for (int s=0; s<image->s(); ++s)
+                    for (int t=0; t<image->t(); ++t)
+                        for (int r=0; r<image->r(); ++r)
+                            newImage->setColor(image->getColor(s,t,r), s,t,r);
                 image = newImage;
             }
-
-            mCache->addEntryToObjectCache(normalized, image);
-            return image;
         }
+        else if (killAlpha)
+        {
+            osg::ref_ptr<osg::Image> newImage = new osg::Image;
+            newImage->setFileName(image->getFileName());
+            newImage->allocateImage(image->s(), image->t(), image->r(), GL_RGB, GL_UNSIGNED_BYTE);
+            // OSG just won't write the alpha as there's nowhere to put it.
+            for (int s = 0; s < image->s(); ++s)
+                for (int t = 0; t < image->t(); ++t)
+                    for (int r = 0; r < image->r(); ++r)
+                        newImage->setColor(image->getColor(s, t, r), s, t, r);
+            image = newImage;
+        }
+
+        mCache->addEntryToObjectCache(normalized, image, 0.0, image->getTotalSizeInBytesIncludingMipmaps());
+        return image;
     }
 
     osg::Image *ImageManager::getWarningImage()
@@ -196,6 +198,7 @@ namespace Resource
     void ImageManager::reportStats(unsigned int frameNumber, osg::Stats *stats) const
     {
         stats->setAttribute(frameNumber, "Image", mCache->getCacheSize());
+        stats->setAttribute(frameNumber, "Image Shared Loads", mCache->getSharedLoadsCount());
     }
 
 }
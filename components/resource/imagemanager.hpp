@@ -39,6 +39,8 @@ namespace Resource
         osg::ref_ptr<osgDB::Options> mOptions;
         osg::ref_ptr<osgDB::Options> mOptionsNoFlip;
 
+        osg::ref_ptr<osg::Image> loadImage(const std::string& filename, const std::string& normalized, bool disableFlip);
+
         ImageManager(const ImageManager&);
         void operator = (const ImageManager&);
     };
@@ -139,10 +139,7 @@ namespace Resource
     {
         const std::string normalized = mVFS->normalizeFilename(name);
 
-        osg::ref_ptr<osg::Object> obj = mCache->getRefFromObjectCache(normalized);
-        if (obj)
-            return osg::ref_ptr<const SceneUtil::KeyframeHolder>(static_cast<SceneUtil::KeyframeHolder*>(obj.get()));
-        else
+        osg::ref_ptr<osg::Object> obj = mCache->getOrLoad(normalized, [&]
         {
             osg::ref_ptr<SceneUtil::KeyframeHolder> loaded (new SceneUtil::KeyframeHolder);
             if (Misc::getFileExtension(normalized) == "kf")
@@ -161,12 +158,14 @@ namespace Resource
             }
             mCache->addEntryToObjectCache(normalized, loaded);
             return loaded;
-        }
+        });
+        return osg::ref_ptr<const SceneUtil::KeyframeHolder>(static_cast<SceneUtil::KeyframeHolder*>(obj.get()));
     }
 
     void KeyframeManager::reportStats(unsigned int frameNumber, osg::Stats *stats) const
     {
         stats->setAttribute(frameNumber, "Keyframe", mCache->getCacheSize());
+        stats->setAttribute(frameNumber, "Keyframe Shared Loads", mCache->getSharedLoadsCount());
     }
 
 
@@ -46,21 +46,20 @@ namespace Resource
 
     Nif::NIFFilePtr NifFileManager::get(const std::string &name)
     {
-        osg::ref_ptr<osg::Object> obj = mCache->getRefFromObjectCache(name);
-        if (obj)
-            return static_cast<NifFileHolder*>(obj.get())->mNifFile;
-        else
+        osg::ref_ptr<osg::Object> obj = mCache->getOrLoad(name, [&]
         {
             Nif::NIFFilePtr file (new Nif::NIFFile(mVFS->get(name), name));
-            obj = new NifFileHolder(file);
-            mCache->addEntryToObjectCache(name, obj);
-            return file;
-        }
+            osg::ref_ptr<osg::Object> holder = new NifFileHolder(file);
+            mCache->addEntryToObjectCache(name, holder);
+            return holder;
+        });
+        return static_cast<NifFileHolder*>(obj.get())->mNifFile;
     }
 
     void NifFileManager::reportStats(unsigned int frameNumber, osg::Stats *stats) const
     {
         stats->setAttribute(frameNumber, "Nif", mCache->getCacheSize());
+        stats->setAttribute(frameNumber, "Nif Shared Loads", mCache->getSharedLoadsCount());
     }
 
 }
@@ -3,6 +3,9 @@
 // - removeExpiredObjectsInCache no longer keeps a lock while the unref happens.
 // - template allows customized KeyType.
 // - objects with uninitialized time stamp are not removed.
+// - objects are distributed over independently locked shards by key hash.
+// - optional size limit based on estimated object sizes, least recently used unreferenced objects are removed first.
+// - getOrLoad shares a single load between concurrent requests for the same key.
 
 /* -*-c++-*- OpenSceneGraph - Copyright (C) 1998-2006 Robert Osfield
  *
@@ -24,9 +27,19 @@
 #include <osg/ref_ptr>
 #include <osg/Node>
 
+#include <array>
+#include <atomic>
+#include <functional>
+#include <future>
+#include <limits>
+#include <list>
 #include <string>
 #include <map>
 #include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace osg
 {
@@ -37,6 +50,12 @@ namespace osg
 
 namespace Resource {
 
+template <class T, class = void>
+struct IsStdHashable : std::false_type {};
+
+template <class T>
+struct IsStdHashable<T, std::void_t<decltype(std::hash<T>()(std::declval<const T&>()))>> : std::true_type {};
+
 template <typename KeyType>
 class GenericObjectCache : public osg::Referenced
 {
@@ -54,38 +73,47 @@ class GenericObjectCache : public osg::Referenced
         void updateTimeStampOfObjectsInCacheWithExternalReferences(double referenceTime)
         {
             // look for objects with external references and update their time stamp.
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            for(typename ObjectCacheMap::iterator itr=_objectCache.begin(); itr!=_objectCache.end(); ++itr)
+            for (Shard& shard : _shards)
             {
-                // If ref count is greater than 1, the object has an external reference.
-                // If the timestamp is yet to be initialized, it needs to be updated too.
-                if (itr->second.first->referenceCount()>1 || itr->second.second == 0.0)
-                    itr->second.second = referenceTime;
+                std::lock_guard<std::mutex> lock(shard._mutex);
+                for(typename ObjectCacheMap::iterator itr=shard._objectCache.begin(); itr!=shard._objectCache.end(); ++itr)
+                {
+                    // If ref count is greater than 1, the object has an external reference.
+                    // If the timestamp is yet to be initialized, it needs to be updated too.
+                    if (itr->second._object->referenceCount()>1 || itr->second._timeStamp == 0.0)
+                        updateTimeStamp(shard, itr->second, referenceTime);
+                }
             }
+            _lastReferenceTime = referenceTime;
         }
 
         /** Removed object in the cache which have a time stamp at or before the specified expiry time.
           * This would typically be called once per frame by applications which are doing database paging,
           * and need to prune objects that are no longer required, and called after the a called
-          * after the call to updateTimeStampOfObjectsInCacheWithExternalReferences(expirtyTime).*/
+          * after the call to updateTimeStampOfObjectsInCacheWithExternalReferences(expirtyTime).
+          * If the maximum size is set and exceeded, objects without external references are removed
+          * starting with the least recently used until the cache fits.*/
         void removeExpiredObjectsInCache(double expiryTime)
         {
             std::vector<osg::ref_ptr<osg::Object> > objectsToRemove;
+            for (Shard& shard : _shards)
             {
-                std::lock_guard<std::mutex> lock(_objectCacheMutex);
+                std::lock_guard<std::mutex> lock(shard._mutex);
                 // Remove expired entries from object cache
-                typename ObjectCacheMap::iterator oitr = _objectCache.begin();
-                while(oitr != _objectCache.end())
+                typename ObjectCacheMap::iterator oitr = shard._objectCache.begin();
+                while(oitr != shard._objectCache.end())
                 {
-                    if (oitr->second.second<=expiryTime)
+                    if (oitr->second._timeStamp<=expiryTime)
                     {
-                        objectsToRemove.push_back(oitr->second.first);
-                        _objectCache.erase(oitr++);
+                        objectsToRemove.push_back(oitr->second._object);
+                        erase(shard, oitr++);
                     }
                     else
                         ++oitr;
                 }
             }
+            if (_maxSize != 0 && _size > _maxSize)
+                removeLeastRecentlyUsedObjects(objectsToRemove);
             // note, actual unref happens outside of the lock
             objectsToRemove.clear();
         }
@@ -93,43 +121,109 @@ class GenericObjectCache : public osg::Referenced
         /** Remove all objects in the cache regardless of having external references or expiry times.*/
         void clear()
         {
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            _objectCache.clear();
+            for (Shard& shard : _shards)
+            {
+                std::lock_guard<std::mutex> lock(shard._mutex);
+                for (const auto& v : shard._objectCache)
+                    _size -= v.second._size;
+                shard._objectCache.clear();
+                shard._leastRecentlyUsed.clear();
+            }
         }
 
-        /** Add a key,object,timestamp triple to the Registry::ObjectCache.*/
-        void addEntryToObjectCache(const KeyType& key, osg::Object* object, double timestamp = 0.0)
+        /** Add a key,object,timestamp triple to the Registry::ObjectCache.
+          * @param size Estimated memory used by the object in bytes, only used to enforce the maximum cache size.*/
+        void addEntryToObjectCache(const KeyType& key, osg::Object* object, double timestamp = 0.0, std::size_t size = 0)
         {
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            _objectCache[key]=ObjectTimeStampPair(object,timestamp);
+            Shard& shard = getShard(key);
+            std::lock_guard<std::mutex> lock(shard._mutex);
+            const auto [itr, inserted] = shard._objectCache.try_emplace(key);
+            Item& item = itr->second;
+            if (inserted)
+                item._leastRecentlyUsedPosition = shard._leastRecentlyUsed.insert(shard._leastRecentlyUsed.end(), key);
+            _size -= item._size;
+            item._object = object;
+            item._size = size;
+            updateTimeStamp(shard, item, timestamp);
+            _size += size;
         }
 
         /** Remove Object from cache.*/
         void removeFromObjectCache(const KeyType& key)
         {
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            typename ObjectCacheMap::iterator itr = _objectCache.find(key);
-            if (itr!=_objectCache.end()) _objectCache.erase(itr);
+            Shard& shard = getShard(key);
+            std::lock_guard<std::mutex> lock(shard._mutex);
+            typename ObjectCacheMap::iterator itr = shard._objectCache.find(key);
+            if (itr!=shard._objectCache.end())
+                erase(shard, itr);
         }
 
         /** Get an ref_ptr<Object> from the object cache*/
         osg::ref_ptr<osg::Object> getRefFromObjectCache(const KeyType& key)
         {
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            typename ObjectCacheMap::iterator itr = _objectCache.find(key);
-            if (itr!=_objectCache.end())
-                return itr->second.first;
+            Shard& shard = getShard(key);
+            std::lock_guard<std::mutex> lock(shard._mutex);
+            typename ObjectCacheMap::iterator itr = shard._objectCache.find(key);
+            if (itr!=shard._objectCache.end())
+                return itr->second._object;
             else return nullptr;
         }
 
+        /** Get an ref_ptr<Object> from the object cache or create it by calling load if it's not there.
+          * Concurrent calls for the same key wait for the single load in progress instead of loading the object again.
+          * load is expected to add the object to the cache, the result is shared with waiting callers either way.
+          * Exception thrown by load is rethrown to all of them.*/
+        template <class Load>
+        osg::ref_ptr<osg::Object> getOrLoad(const KeyType& key, Load&& load)
+        {
+            Shard& shard = getShard(key);
+            std::promise<osg::ref_ptr<osg::Object>> promise;
+            {
+                std::unique_lock<std::mutex> lock(shard._mutex);
+                typename ObjectCacheMap::iterator itr = shard._objectCache.find(key);
+                if (itr != shard._objectCache.end())
+                    return itr->second._object;
+                typename LoadingMap::iterator loading = shard._loading.find(key);
+                if (loading != shard._loading.end())
+                {
+                    // Recursive load of the same key by the loading thread can't wait for itself
+                    if (loading->second._thread == std::this_thread::get_id())
+                    {
+                        lock.unlock();
+                        return load();
+                    }
+                    const std::shared_future<osg::ref_ptr<osg::Object>> result = loading->second._result;
+                    lock.unlock();
+                    ++_sharedLoads;
+                    return result.get();
+                }
+                shard._loading.emplace(key, Loading {std::this_thread::get_id(), promise.get_future().share()});
+            }
+            osg::ref_ptr<osg::Object> result;
+            try
+            {
+                result = load();
+            }
+            catch (...)
+            {
+                promise.set_exception(std::current_exception());
+                removeLoading(shard, key);
+                throw;
+            }
+            promise.set_value(result);
+            removeLoading(shard, key);
+            return result;
+        }
+
         /** Check if an object is in the cache, and if it is, update its usage time stamp. */
         bool checkInObjectCache(const KeyType& key, double timeStamp)
         {
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            typename ObjectCacheMap::iterator itr = _objectCache.find(key);
-            if (itr!=_objectCache.end())
+            Shard& shard = getShard(key);
+            std::lock_guard<std::mutex> lock(shard._mutex);
+            typename ObjectCacheMap::iterator itr = shard._objectCache.find(key);
+            if (itr!=shard._objectCache.end())
             {
-                itr->second.second = timeStamp;
+                updateTimeStamp(shard, itr->second, timeStamp);
                 return true;
             }
             else return false;
@@ -138,26 +232,32 @@ class GenericObjectCache : public osg::Referenced
         /** call releaseGLObjects on all objects attached to the object cache.*/
         void releaseGLObjects(osg::State* state)
         {
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            for(typename ObjectCacheMap::iterator itr = _objectCache.begin(); itr != _objectCache.end(); ++itr)
+            for (Shard& shard : _shards)
             {
-                osg::Object* object = itr->second.first.get();
-                object->releaseGLObjects(state);
+                std::lock_guard<std::mutex> lock(shard._mutex);
+                for(typename ObjectCacheMap::iterator itr = shard._objectCache.begin(); itr != shard._objectCache.end(); ++itr)
+                {
+                    osg::Object* object = itr->second._object.get();
+                    object->releaseGLObjects(state);
+                }
             }
         }
 
         /** call node->accept(nv); for all nodes in the objectCache. */
         void accept(osg::NodeVisitor& nv)
         {
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            for(typename ObjectCacheMap::iterator itr = _objectCache.begin(); itr != _objectCache.end(); ++itr)
+            for (Shard& shard : _shards)
             {
-                osg::Object* object = itr->second.first.get();
-                if (object)
+                std::lock_guard<std::mutex> lock(shard._mutex);
+                for(typename ObjectCacheMap::iterator itr = shard._objectCache.begin(); itr != shard._objectCache.end(); ++itr)
                 {
-                    osg::Node* node = dynamic_cast<osg::Node*>(object);
-                    if (node)
-                        node->accept(nv);
+                    osg::Object* object = itr->second._object.get();
+                    if (object)
+                    {
+                        osg::Node* node = dynamic_cast<osg::Node*>(object);
+                        if (node)
+                            node->accept(nv);
+                    }
                 }
             }
         }
@@ -166,28 +266,160 @@ class GenericObjectCache : public osg::Referenced
         template <class Functor>
         void call(Functor& f)
         {
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            for (typename ObjectCacheMap::iterator it = _objectCache.begin(); it != _objectCache.end(); ++it)
-                f(it->first, it->second.first.get());
+            for (Shard& shard : _shards)
+            {
+                std::lock_guard<std::mutex> lock(shard._mutex);
+                for (typename ObjectCacheMap::iterator it = shard._objectCache.begin(); it != shard._objectCache.end(); ++it)
+                    f(it->first, it->second._object.get());
+            }
         }
 
         /** Get the number of objects in the cache. */
         unsigned int getCacheSize() const
         {
-            std::lock_guard<std::mutex> lock(_objectCacheMutex);
-            return _objectCache.size();
+            std::size_t result = 0;
+            for (const Shard& shard : _shards)
+            {
+                std::lock_guard<std::mutex> lock(shard._mutex);
+                result += shard._objectCache.size();
+            }
+            return static_cast<unsigned int>(result);
         }
 
+        /** Get the sum of estimated sizes of objects in the cache in bytes. */
+        std::size_t getCacheMemorySize() const { return _size; }
+
+        /** Set the maximum sum of estimated object sizes in bytes, 0 means no limit.
+          * Applied on the next removeExpiredObjectsInCache call.*/
+        void setMaxCacheMemorySize(std::size_t value) { _maxSize = value; }
+
+        std::size_t getMaxCacheMemorySize() const { return _maxSize; }
+
+        /** Get the number of getOrLoad calls which waited for a load in progress instead of loading the object again. */
+        std::size_t getSharedLoadsCount() const { return _sharedLoads; }
+
     protected:
 
         virtual ~GenericObjectCache() {}
 
-        typedef std::pair<osg::ref_ptr<osg::Object>, double >           ObjectTimeStampPair;
-        typedef std::map<KeyType, ObjectTimeStampPair >             ObjectCacheMap;
+        typedef std::list<KeyType>                  LeastRecentlyUsedList;
+
+        struct Item
+        {
+            osg::ref_ptr<osg::Object> _object;
+            double _timeStamp = 0.0;
+            std::size_t _size = 0;
+            typename LeastRecentlyUsedList::iterator _leastRecentlyUsedPosition;
+        };
 
-        ObjectCacheMap                          _objectCache;
-        mutable std::mutex                      _objectCacheMutex;
+        typedef std::map<KeyType, Item>             ObjectCacheMap;
 
+        struct Loading
+        {
+            std::thread::id _thread;
+            std::shared_future<osg::ref_ptr<osg::Object>> _result;
+        };
+
+        typedef std::map<KeyType, Loading>          LoadingMap;
+
+        struct Shard
+        {
+            ObjectCacheMap                          _objectCache;
+            // Keys ordered by the last time stamp update, time stamps are expected to be non decreasing
+            LeastRecentlyUsedList                   _leastRecentlyUsed;
+            LoadingMap                              _loading;
+            mutable std::mutex                      _mutex;
+        };
+
+        // Keys without std::hash specialization can't be distributed and use single shard
+        static constexpr std::size_t _numShards = IsStdHashable<KeyType>::value ? 16 : 1;
+
+        std::array<Shard, _numShards>           _shards;
+        std::atomic_size_t                      _size {0};
+        std::atomic_size_t                      _maxSize {0};
+        std::atomic_size_t                      _sharedLoads {0};
+        std::atomic<double>                     _lastReferenceTime {std::numeric_limits<double>::max()};
+
+        Shard& getShard(const KeyType& key)
+        {
+            if constexpr (_numShards == 1)
+                return _shards[0];
+            else
+                return _shards[std::hash<KeyType>()(key) % _numShards];
+        }
+
+        void removeLoading(Shard& shard, const KeyType& key)
+        {
+            std::lock_guard<std::mutex> lock(shard._mutex);
+            shard._loading.erase(key);
+        }
+
+        void updateTimeStamp(Shard& shard, Item& item, double timeStamp)
+        {
+            item._timeStamp = timeStamp;
+            shard._leastRecentlyUsed.splice(shard._leastRecentlyUsed.end(), shard._leastRecentlyUsed,
+                item._leastRecentlyUsedPosition);
+        }
+
+        void erase(Shard& shard, typename ObjectCacheMap::iterator itr)
+        {
+            _size -= itr->second._size;
+            shard._leastRecentlyUsed.erase(itr->second._leastRecentlyUsedPosition);
+            shard._objectCache.erase(itr);
+        }
+
+        /** Find the least recently used object which is not referenced, has a size and an initialized time stamp.
+          * Objects used since the last updateTimeStampOfObjectsInCacheWithExternalReferences are not considered,
+          * so when all objects are in use the search stops at the first one.*/
+        typename ObjectCacheMap::iterator findEvictable(Shard& shard, double lastReferenceTime)
+        {
+            for (const KeyType& key : shard._leastRecentlyUsed)
+            {
+                const typename ObjectCacheMap::iterator itr = shard._objectCache.find(key);
+                const Item& item = itr->second;
+                if (item._timeStamp >= lastReferenceTime)
+                    break;
+                if (item._timeStamp != 0.0 && item._size != 0 && item._object->referenceCount() == 1)
+                    return itr;
+            }
+            return shard._objectCache.end();
+        }
+
+        void removeLeastRecentlyUsedObjects(std::vector<osg::ref_ptr<osg::Object> >& objectsToRemove)
+        {
+            const double lastReferenceTime = _lastReferenceTime;
+            while (_size > _maxSize)
+            {
+                // Shards are ordered independently, the oldest of their least recently used objects goes first
+                std::size_t oldestShard = _numShards;
+                double oldestTimeStamp = 0.0;
+                for (std::size_t i = 0; i < _numShards; ++i)
+                {
+                    Shard& shard = _shards[i];
+                    std::lock_guard<std::mutex> lock(shard._mutex);
+                    const auto itr = findEvictable(shard, lastReferenceTime);
+                    if (itr != shard._objectCache.end()
+                        && (oldestShard == _numShards || itr->second._timeStamp < oldestTimeStamp))
+                    {
+                        oldestShard = i;
+                        oldestTimeStamp = itr->second._timeStamp;
+                    }
+                }
+
+                // Nothing can be freed until some objects lose their external references
+                if (oldestShard == _numShards)
+                    break;
+
+                Shard& shard = _shards[oldestShard];
+                std::lock_guard<std::mutex> lock(shard._mutex);
+                // Object might be referenced or removed since it was found
+                const auto itr = findEvictable(shard, lastReferenceTime);
+                if (itr == shard._objectCache.end())
+                    continue;
+                objectsToRemove.push_back(itr->second._object);
+                erase(shard, itr);
+            }
+        }
 };
 
 class ObjectCache : public GenericObjectCache<std::string>
@@ -61,6 +61,9 @@ namespace Resource
         void setExpiryDelay (double expiryDelay) override { mExpiryDelay = expiryDelay; }
         float getExpiryDelay() const { return mExpiryDelay; }
 
+        /// Limit estimated memory used by cached objects without external references, 0 means no limit.
+        void setMaxCacheMemorySize(std::size_t value) { mCache->setMaxCacheMemorySize(value); }
+
         const VFS::Manager* getVFS() const { return mVFS; }
 
         void reportStats(unsigned int frameNumber, osg::Stats* stats) const override {}
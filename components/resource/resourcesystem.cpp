@@ -91,6 +91,16 @@ namespace Resource
         return mVFS;
     }
 
+    void ResourceSystem::setShapeDiskCachePath(const std::filesystem::path& path)
+    {
+        mShapeDiskCachePath = path;
+    }
+
+    const std::filesystem::path& ResourceSystem::getShapeDiskCachePath() const
+    {
+        return mShapeDiskCachePath;
+    }
+
     void ResourceSystem::reportStats(unsigned int frameNumber, osg::Stats *stats) const
     {
         for (std::vector<BaseResourceManager*>::const_iterator it = mResourceManagers.begin(); it != mResourceManagers.end(); ++it)
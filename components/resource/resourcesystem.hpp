@@ -1,6 +1,7 @@
 #ifndef OPENMW_COMPONENTS_RESOURCE_RESOURCESYSTEM_H
 #define OPENMW_COMPONENTS_RESOURCE_RESOURCESYSTEM_H
 
+#include <filesystem>
 #include <memory>
 #include <vector>
 
@@ -59,6 +60,11 @@ namespace Resource
         /// @note May be called from any thread.
         const VFS::Manager* getVFS() const;
 
+        /// Where collision shape managers store converted shapes, disabled when empty.
+        void setShapeDiskCachePath(const std::filesystem::path& path);
+
+        const std::filesystem::path& getShapeDiskCachePath() const;
+
         void reportStats(unsigned int frameNumber, osg::Stats* stats) const;
 
         /// Call releaseGLObjects for each resource manager.
@@ -76,6 +82,8 @@ namespace Resource
 
         const VFS::Manager* mVFS;
 
+        std::filesystem::path mShapeDiskCachePath;
+
         ResourceSystem(const ResourceSystem&);
         void operator = (const ResourceSystem&);
     };
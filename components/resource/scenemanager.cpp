@@ -4,6 +4,7 @@
 #include <filesystem>
 
 #include <osg/AlphaFunc>
+#include <osg/Geometry>
 #include <osg/Group>
 #include <osg/Node>
 #include <osg/UserDataContainer>
@@ -52,6 +53,7 @@
 #include "imagemanager.hpp"
 #include "niffilemanager.hpp"
 #include "objectcache.hpp"
+#include "templatediskcache.hpp"
 
 namespace
 {
@@ -123,6 +125,50 @@ namespace
     private:
         unsigned int mMask;
     };
+
+    /// Estimates memory used by geometry data of the scene graph, textures are accounted by the ImageManager.
+    class EstimateSizeVisitor : public osg::NodeVisitor
+    {
+    public:
+        EstimateSizeVisitor()
+            : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
+        {
+        }
+
+        void apply(osg::Node& node) override
+        {
+            mSize += sizeof(osg::Node);
+            traverse(node);
+        }
+
+        void apply(osg::Drawable& drawable) override
+        {
+            mSize += sizeof(osg::Drawable);
+            const osg::Geometry* geometry = drawable.asGeometry();
+            if (geometry == nullptr)
+                return;
+            addArray(geometry->getVertexArray());
+            addArray(geometry->getNormalArray());
+            addArray(geometry->getColorArray());
+            for (const auto& array : geometry->getTexCoordArrayList())
+                addArray(array.get());
+            for (const auto& array : geometry->getVertexAttribArrayList())
+                addArray(array.get());
+            for (const auto& primitiveSet : geometry->getPrimitiveSetList())
+                mSize += primitiveSet->getTotalDataSize();
+        }
+
+        std::size_t getSize() const { return mSize; }
+
+    private:
+        std::size_t mSize = 0;
+
+        void addArray(const osg::Array* array)
+        {
+            if (array != nullptr)
+                mSize += array->getTotalDataSize();
+        }
+    };
 }
 
 namespace Resource
@@ -724,6 +770,14 @@ namespace Resource
         return options;
     }
 
+    void SceneManager::setTemplateDiskCachePath(const std::filesystem::path& path)
+    {
+        if (path.empty())
+            mTemplateDiskCache = nullptr;
+        else
+            mTemplateDiskCache = std::make_unique<TemplateDiskCache>(path, *mVFS, new ImageReadCallback(mImageManager));
+    }
+
     void SceneManager::shareState(osg::ref_ptr<osg::Node> node) {
         mSharedStateMutex.lock();
         mSharedStateManager->share(node.get());
@@ -732,73 +786,86 @@ namespace Resource
 
     osg::ref_ptr<const osg::Node> SceneManager::getTemplate(const std::string &name, bool compile)
     {
-        std::string normalized = mVFS->normalizeFilename(name);
+        const std::string normalized = mVFS->normalizeFilename(name);
 
-        osg::ref_ptr<osg::Object> obj = mCache->getRefFromObjectCache(normalized);
-        if (obj)
-            return osg::ref_ptr<const osg::Node>(static_cast<osg::Node*>(obj.get()));
-        else
+        osg::ref_ptr<osg::Object> obj = mCache->getOrLoad(normalized,
+            [&] { return loadTemplate(name, normalized, compile); });
+        return osg::ref_ptr<const osg::Node>(static_cast<osg::Node*>(obj.get()));
+    }
+
+    osg::ref_ptr<osg::Node> SceneManager::loadTemplate(const std::string& name, std::string normalized, bool compile)
+    {
+        osg::ref_ptr<osg::Node> loaded;
+        try
         {
-            osg::ref_ptr<osg::Node> loaded;
-            try
-            {
-                loaded = load(normalized, mVFS, mImageManager, mNifFileManager);
+            loaded = loadOrReadCached(normalized);
 
-                SceneUtil::ProcessExtraDataVisitor extraDataVisitor(this);
-                loaded->accept(extraDataVisitor);
-            }
-            catch (const std::exception& e)
-            {
-                static osg::ref_ptr<osg::Node> errorMarkerNode = [&] {
-                    static const char* const sMeshTypes[] = { "nif", "osg", "osgt", "osgb", "osgx", "osg2", "dae" };
+            SceneUtil::ProcessExtraDataVisitor extraDataVisitor(this);
+            loaded->accept(extraDataVisitor);
+        }
+        catch (const std::exception& e)
+        {
+            static osg::ref_ptr<osg::Node> errorMarkerNode = [&] {
+                static const char* const sMeshTypes[] = { "nif", "osg", "osgt", "osgb", "osgx", "osg2", "dae" };
 
-                    for (unsigned int i=0; i<sizeof(sMeshTypes)/sizeof(sMeshTypes[0]); ++i)
-                    {
-                        normalized = "meshes/marker_error." + std::string(sMeshTypes[i]);
-                        if (mVFS->exists(normalized))
-                            return load(normalized, mVFS, mImageManager, mNifFileManager);
-                    }
-                    Files::IMemStream file(Misc::errorMarker.data(), Misc::errorMarker.size());
-                    return loadNonNif("error_marker.osgt", file, mImageManager);
-                }();
+                for (unsigned int i=0; i<sizeof(sMeshTypes)/sizeof(sMeshTypes[0]); ++i)
+                {
+                    normalized = "meshes/marker_error." + std::string(sMeshTypes[i]);
+                    if (mVFS->exists(normalized))
+                        return load(normalized, mVFS, mImageManager, mNifFileManager);
+                }
+                Files::IMemStream file(Misc::errorMarker.data(), Misc::errorMarker.size());
+                return loadNonNif("error_marker.osgt", file, mImageManager);
+            }();
 
-                Log(Debug::Error) << "Failed to load '" << name << "': " << e.what() << ", using marker_error instead";
-                loaded = static_cast<osg::Node*>(errorMarkerNode->clone(osg::CopyOp::DEEP_COPY_ALL));
-            }
+            Log(Debug::Error) << "Failed to load '" << name << "': " << e.what() << ", using marker_error instead";
+            loaded = static_cast<osg::Node*>(errorMarkerNode->clone(osg::CopyOp::DEEP_COPY_ALL));
+        }
 
-            // set filtering settings
-            SetFilterSettingsVisitor setFilterSettingsVisitor(mMinFilter, mMagFilter, mMaxAnisotropy);
-            loaded->accept(setFilterSettingsVisitor);
-            SetFilterSettingsControllerVisitor setFilterSettingsControllerVisitor(mMinFilter, mMagFilter, mMaxAnisotropy);
-            loaded->accept(setFilterSettingsControllerVisitor);
+        // set filtering settings
+        SetFilterSettingsVisitor setFilterSettingsVisitor(mMinFilter, mMagFilter, mMaxAnisotropy);
+        loaded->accept(setFilterSettingsVisitor);
+        SetFilterSettingsControllerVisitor setFilterSettingsControllerVisitor(mMinFilter, mMagFilter, mMaxAnisotropy);
+        loaded->accept(setFilterSettingsControllerVisitor);
 
-            SceneUtil::ReplaceDepthVisitor replaceDepthVisitor;
-            loaded->accept(replaceDepthVisitor);
+        SceneUtil::ReplaceDepthVisitor replaceDepthVisitor;
+        loaded->accept(replaceDepthVisitor);
 
-            osg::ref_ptr<Shader::ShaderVisitor> shaderVisitor (createShaderVisitor());
-            loaded->accept(*shaderVisitor);
+        osg::ref_ptr<Shader::ShaderVisitor> shaderVisitor (createShaderVisitor());
+        loaded->accept(*shaderVisitor);
 
-            if (canOptimize(normalized))
-            {
-                SceneUtil::Optimizer optimizer;
-                optimizer.setSharedStateManager(mSharedStateManager, &mSharedStateMutex);
-                optimizer.setIsOperationPermissibleForObjectCallback(new CanOptimizeCallback);
+        if (canOptimize(normalized))
+        {
+            SceneUtil::Optimizer optimizer;
+            optimizer.setSharedStateManager(mSharedStateManager, &mSharedStateMutex);
+            optimizer.setIsOperationPermissibleForObjectCallback(new CanOptimizeCallback);
 
-                static const unsigned int options = getOptimizationOptions()|SceneUtil::Optimizer::SHARE_DUPLICATE_STATE;
+            static const unsigned int options = getOptimizationOptions()|SceneUtil::Optimizer::SHARE_DUPLICATE_STATE;
 
-                optimizer.optimize(loaded, options);
-            }
-            else
-                shareState(loaded);
+            optimizer.optimize(loaded, options);
+        }
+        else
+            shareState(loaded);
 
-            if (compile && mIncrementalCompileOperation)
-                mIncrementalCompileOperation->add(loaded);
-            else
-                loaded->getBound();
+        if (compile && mIncrementalCompileOperation)
+            mIncrementalCompileOperation->add(loaded);
+        else
+            loaded->getBound();
 
-            mCache->addEntryToObjectCache(normalized, loaded);
-            return loaded;
-        }
+        EstimateSizeVisitor estimateSizeVisitor;
+        loaded->accept(estimateSizeVisitor);
+
+        mCache->addEntryToObjectCache(normalized, loaded, 0.0, estimateSizeVisitor.getSize());
+        return loaded;
+    }
+
+    osg::ref_ptr<osg::Node> SceneManager::loadOrReadCached(const std::string& normalized)
+    {
+        if (mTemplateDiskCache == nullptr || Misc::getFileExtension(normalized) != "nif")
+            return load(normalized, mVFS, mImageManager, mNifFileManager);
+
+        return mTemplateDiskCache->getOrLoad(normalized, *mVFS->get(normalized),
+            [&] { return load(normalized, mVFS, mImageManager, mNifFileManager); });
     }
 
     osg::ref_ptr<osg::Node> SceneManager::getInstance(const std::string& name)
@@ -986,6 +1053,14 @@ namespace Resource
         }
 
         stats->setAttribute(frameNumber, "Node", mCache->getCacheSize());
+        stats->setAttribute(frameNumber, "Node Shared Loads", mCache->getSharedLoadsCount());
+
+        if (mTemplateDiskCache != nullptr)
+        {
+            const DiskCache::Stats diskCacheStats = mTemplateDiskCache->getStats();
+            stats->setAttribute(frameNumber, "Node Disk Cache Hits", diskCacheStats.mHits);
+            stats->setAttribute(frameNumber, "Node Disk Cache Misses", diskCacheStats.mMisses);
+        }
     }
 
     Shader::ShaderVisitor *SceneManager::createShaderVisitor(const std::string& shaderPrefix)
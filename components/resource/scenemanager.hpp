@@ -1,6 +1,7 @@
 #ifndef OPENMW_COMPONENTS_RESOURCE_SCENEMANAGER_H
 #define OPENMW_COMPONENTS_RESOURCE_SCENEMANAGER_H
 
+#include <filesystem>
 #include <string>
 #include <map>
 #include <memory>
@@ -20,6 +21,7 @@ namespace Resource
     class ImageManager;
     class NifFileManager;
     class SharedStateManager;
+    class TemplateDiskCache;
 }
 
 namespace osgUtil
@@ -126,6 +128,11 @@ namespace Resource
 
         void setShaderPath(const std::string& path);
 
+        /// Store scene graphs converted from NIF files in the given directory and reuse them in later sessions
+        /// instead of converting the same files again. Empty path disables the cache.
+        /// @note Not thread safe, should be called before loading any scenes.
+        void setTemplateDiskCachePath(const std::filesystem::path& path);
+
         /// Check if a given scene is loaded and if so, update its usage timestamp to prevent it from being unloaded
         bool checkLoaded(const std::string& name, double referenceTime);
 
@@ -205,6 +212,10 @@ namespace Resource
 
         Shader::ShaderVisitor* createShaderVisitor(const std::string& shaderPrefix = "objects");
 
+        osg::ref_ptr<osg::Node> loadTemplate(const std::string& name, std::string normalized, bool compile);
+
+        osg::ref_ptr<osg::Node> loadOrReadCached(const std::string& normalized);
+
         std::unique_ptr<Shader::ShaderManager> mShaderManager;
         bool mForceShaders;
         bool mClampLighting;
@@ -226,6 +237,7 @@ namespace Resource
 
         Resource::ImageManager* mImageManager;
         Resource::NifFileManager* mNifFileManager;
+        std::unique_ptr<TemplateDiskCache> mTemplateDiskCache;
 
         osg::Texture::FilterMode mMinFilter;
         osg::Texture::FilterMode mMagFilter;
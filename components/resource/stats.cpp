@@ -427,6 +427,18 @@ void StatsHandler::setUpScene(osgViewer::ViewerBase *viewer)
             "Image",
             "Nif",
             "Keyframe",
+            "Node Shared Loads",
+            "Shape Shared Loads",
+            "Image Shared Loads",
+            "Nif Shared Loads",
+            "Keyframe Shared Loads",
+            "Node Disk Cache Hits",
+            "Node Disk Cache Misses",
+            "Shape Disk Cache Hits",
+            "Shape Disk Cache Misses",
+            "Archive Cache Size",
+            "Archive Cache Hits",
+            "Archive Cache Misses",
             "",
             "Groundcover Chunk",
             "Object Chunk",
@@ -439,8 +451,14 @@ void StatsHandler::setUpScene(osgViewer::ViewerBase *viewer)
             "NavMesh Waiting",
             "NavMesh Pushed",
             "NavMesh Processing",
+            "NavMesh PathRequests",
+            "NavMesh PathProcessing",
+            "NavMesh PathCacheSize",
+            "NavMesh PathCacheHitRate",
             "NavMesh DbJobs",
             "NavMesh DbCacheHitRate",
+            "NavMesh DbWrittenTiles",
+            "NavMesh DbCommits",
             "NavMesh CacheSize",
             "NavMesh UsedTiles",
             "NavMesh CachedTiles",
@@ -453,6 +471,12 @@ void StatsHandler::setUpScene(osgViewer::ViewerBase *viewer)
             "Physics Objects",
             "Physics Projectiles",
             "Physics HeightFields",
+            "Physics LOSCacheSize",
+            "Physics LOSCacheHits",
+            "Physics LOSCacheMisses",
+            "",
+            "World SearchPtrHits",
+            "World SearchPtrMisses",
         });
 
         static const auto longest = std::max_element(statNames.begin(), statNames.end(),
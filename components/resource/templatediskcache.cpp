@@ -0,0 +1,210 @@
+#include "templatediskcache.hpp"
+
+#include <osg/NodeVisitor>
+#include <osg/StateSet>
+#include <osg/Texture>
+#include <osg/UserDataContainer>
+
+#include <osgDB/Options>
+#include <osgDB/Registry>
+
+#include <components/debug/debuglog.hpp>
+#include <components/files/hash.hpp>
+#include <components/nifosg/matrixtransform.hpp>
+#include <components/nifosg/nifloader.hpp>
+#include <components/sceneutil/serialize.hpp>
+#include <components/vfs/manager.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <typeinfo>
+
+namespace Resource
+{
+    namespace
+    {
+        // Increase when NifOsg::Loader output for the same NIF file changes
+        constexpr unsigned sFormatVersion = 1;
+
+        // NifOsg::Loader resolves texture names with Misc::ResourceHelpers::correctTexturePath, the result depends only
+        // on which files exist there
+        std::array<std::uint64_t, 2> getTexturesHash(const VFS::Manager& vfs)
+        {
+            std::string names;
+            for (const std::string& name : vfs.getRecursiveDirectoryIterator("textures/"))
+            {
+                names += name;
+                names += '\n';
+            }
+            std::istringstream stream(names);
+            return Files::getHash("textures", stream);
+        }
+
+        bool isCoreObject(const osg::Object& object)
+        {
+            return std::strcmp(object.libraryName(), "osg") == 0;
+        }
+
+        bool isSerializableUserData(const osg::Object& object)
+        {
+            const osg::UserDataContainer* const container = object.getUserDataContainer();
+            if (container == nullptr)
+                return true;
+            if (!isCoreObject(*container) || container->getUserData() != nullptr)
+                return false;
+            for (unsigned i = 0; i < container->getNumUserObjects(); ++i)
+                if (!isCoreObject(*container->getUserObject(i)))
+                    return false;
+            return true;
+        }
+
+        bool isSerializableAttribute(const osg::StateAttribute& attribute)
+        {
+            if (!isCoreObject(attribute) || attribute.getUpdateCallback() != nullptr
+                || attribute.getEventCallback() != nullptr || !isSerializableUserData(attribute))
+                return false;
+            if (const osg::Texture* const texture = attribute.asTexture())
+            {
+                // Images are written as references to files, so embedded and generated ones would be lost
+                for (unsigned i = 0; i < texture->getNumImages(); ++i)
+                {
+                    const osg::Image* const image = texture->getImage(i);
+                    if (image != nullptr && image->getFileName().empty())
+                        return false;
+                }
+            }
+            return true;
+        }
+
+        bool isSerializableStateSet(const osg::StateSet& stateSet)
+        {
+            if (!isCoreObject(stateSet) || stateSet.getUpdateCallback() != nullptr
+                || stateSet.getEventCallback() != nullptr || !isSerializableUserData(stateSet))
+                return false;
+            for (const auto& [type, attribute] : stateSet.getAttributeList())
+                if (!isSerializableAttribute(*attribute.first))
+                    return false;
+            for (const auto& attributes : stateSet.getTextureAttributeList())
+                for (const auto& [type, attribute] : attributes)
+                    if (!isSerializableAttribute(*attribute.first))
+                        return false;
+            for (const auto& [name, uniform] : stateSet.getUniformList())
+                if (!isCoreObject(*uniform.first) || !isSerializableUserData(*uniform.first))
+                    return false;
+            return true;
+        }
+
+        bool isSerializableNode(const osg::Node& node)
+        {
+            if (!isCoreObject(node) && typeid(node) != typeid(NifOsg::MatrixTransform))
+                return false;
+            if (node.getUpdateCallback() != nullptr || node.getEventCallback() != nullptr
+                || node.getCullCallback() != nullptr || node.getComputeBoundingSphereCallback() != nullptr)
+                return false;
+            if (const osg::Drawable* const drawable = node.asDrawable())
+                if (drawable->getDrawCallback() != nullptr || drawable->getComputeBoundingBoxCallback() != nullptr)
+                    return false;
+            if (!isSerializableUserData(node))
+                return false;
+            return node.getStateSet() == nullptr || isSerializableStateSet(*node.getStateSet());
+        }
+
+        class CheckSerializableVisitor : public osg::NodeVisitor
+        {
+        public:
+            CheckSerializableVisitor()
+                : osg::NodeVisitor(TRAVERSE_ALL_CHILDREN)
+            {
+            }
+
+            void apply(osg::Node& node) override
+            {
+                if (!mSerializable)
+                    return;
+                if (!isSerializableNode(node))
+                {
+                    mSerializable = false;
+                    return;
+                }
+                traverse(node);
+            }
+
+            bool mSerializable = true;
+        };
+    }
+
+    TemplateDiskCache::TemplateDiskCache(const std::filesystem::path& path, const VFS::Manager& vfs,
+        osgDB::ReadFileCallback* readImageCallback)
+        : mFiles(path, "model")
+        , mTexturesHash(getTexturesHash(vfs))
+        , mReaderWriter(osgDB::Registry::instance()->getReaderWriterForExtension("osgb"))
+        , mReadOptions(new osgDB::Options)
+        , mWriteOptions(new osgDB::Options)
+    {
+        SceneUtil::registerCacheSerializers();
+
+        mReadOptions->setReadFileCallback(readImageCallback);
+        mWriteOptions->setPluginStringData("WriteImageHint", "UseExternal");
+
+        if (mReaderWriter == nullptr)
+            Log(Debug::Warning) << "No readerwriter for 'osgb' found, converted models will not be cached";
+    }
+
+    TemplateDiskCache::~TemplateDiskCache() = default;
+
+    bool TemplateDiskCache::isEnabled() const
+    {
+        // Debug scene graph export replaces osg::Geometry serializer, cached files would have no geometry. Checked again
+        // by read and write with the serializer locked.
+        return mReaderWriter != nullptr && SceneUtil::isGeometryDataSerialized();
+    }
+
+    std::string TemplateDiskCache::getFileNameSuffix() const
+    {
+        char suffix[96];
+        std::snprintf(suffix, sizeof(suffix), "-%u-%d-%08x-%08x-%016llx%016llx.osgb", sFormatVersion,
+            NifOsg::Loader::getShowMarkers() ? 1 : 0, NifOsg::Loader::getHiddenNodeMask(),
+            NifOsg::Loader::getIntersectionDisabledNodeMask(), static_cast<unsigned long long>(mTexturesHash[0]),
+            static_cast<unsigned long long>(mTexturesHash[1]));
+        return suffix;
+    }
+
+    osg::ref_ptr<osg::Node> TemplateDiskCache::read(std::istream& stream) const
+    {
+        const auto lock = SceneUtil::lockGeometrySerializer();
+        if (!SceneUtil::isGeometryDataSerialized())
+            return nullptr;
+
+        osgDB::ReaderWriter::ReadResult result = mReaderWriter->readNode(stream, mReadOptions);
+        if (!result.success() || result.getNode() == nullptr)
+            throw std::runtime_error(result.message());
+
+        return result.getNode();
+    }
+
+    bool TemplateDiskCache::write(const osg::Node& node, std::ostream& stream) const
+    {
+        if (!isSerializableTemplate(node))
+            return false;
+
+        const auto lock = SceneUtil::lockGeometrySerializer();
+        if (!SceneUtil::isGeometryDataSerialized())
+            return false;
+
+        const osgDB::ReaderWriter::WriteResult result = mReaderWriter->writeNode(node, stream, mWriteOptions);
+        if (!result.success())
+            throw std::runtime_error(result.message());
+        return true;
+    }
+
+    bool isSerializableTemplate(const osg::Node& node)
+    {
+        CheckSerializableVisitor visitor;
+        const_cast<osg::Node&>(node).accept(visitor);
+        return visitor.mSerializable;
+    }
+}
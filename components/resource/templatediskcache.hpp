@@ -0,0 +1,78 @@
+#ifndef OPENMW_COMPONENTS_RESOURCE_TEMPLATEDISKCACHE_H
+#define OPENMW_COMPONENTS_RESOURCE_TEMPLATEDISKCACHE_H
+
+#include "diskcache.hpp"
+
+#include <osg/Node>
+#include <osg/ref_ptr>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <string>
+#include <utility>
+
+namespace osgDB
+{
+    class Options;
+    class ReadFileCallback;
+    class ReaderWriter;
+}
+
+namespace VFS
+{
+    class Manager;
+}
+
+namespace Resource
+{
+    /// @brief Stores scene graphs converted from NIF files in the osgb format to not parse and convert the same files
+    /// in later sessions. Files are named by the hash of NIF file content, NifOsg::Loader settings affecting the result
+    /// and the list of files in the textures directory of the VFS, as NIF texture names are resolved against it.
+    /// Only scene graphs consisting of core osg classes and NifOsg::MatrixTransform without callbacks, and with all
+    /// images loaded from files, are stored. Other ones, like animated, skinned or particle meshes, are always converted.
+    /// Images are stored as references to the resolved files and read through the given callback.
+    /// @note Thread safe.
+    class TemplateDiskCache
+    {
+    public:
+        TemplateDiskCache(const std::filesystem::path& path, const VFS::Manager& vfs,
+            osgDB::ReadFileCallback* readImageCallback);
+        ~TemplateDiskCache();
+
+        /// @param stream content of the NIF file, used to make the cache key.
+        /// @param load converts the NIF file when there is no cached scene graph, the result is stored if possible.
+        template <class Load>
+        osg::ref_ptr<osg::Node> getOrLoad(const std::string& normalizedFilename, std::istream& stream, Load&& load)
+        {
+            if (!isEnabled())
+                return load();
+            return mFiles.getOrLoad(normalizedFilename, stream, getFileNameSuffix(),
+                [&] (std::istream& file) { return read(file); }, std::forward<Load>(load),
+                [&] (const osg::Node& node, std::ostream& file) { return write(node, file); });
+        }
+
+        DiskCache::Stats getStats() const { return mFiles.getStats(); }
+
+    private:
+        DiskCache mFiles;
+        const std::array<std::uint64_t, 2> mTexturesHash;
+        osgDB::ReaderWriter* const mReaderWriter;
+        osg::ref_ptr<osgDB::Options> mReadOptions;
+        osg::ref_ptr<osgDB::Options> mWriteOptions;
+
+        bool isEnabled() const;
+
+        std::string getFileNameSuffix() const;
+
+        osg::ref_ptr<osg::Node> read(std::istream& stream) const;
+
+        bool write(const osg::Node& node, std::ostream& stream) const;
+    };
+
+    /// @return true if the scene graph can be written in osgb format and read back without losing any data
+    bool isSerializableTemplate(const osg::Node& node);
+}
+
+#endif
@@ -5,6 +5,7 @@
 #include <osg/MatrixTransform>
 
 #include "skeleton.hpp"
+#include "skinning.hpp"
 #include "util.hpp"
 
 namespace
@@ -30,6 +31,14 @@ namespace
         ptrresult[13] += ptr[13] * weight;
         ptrresult[14] += ptr[14] * weight;
     }
+
+    template <class Array>
+    auto getData(Array* array) -> decltype(array->front().ptr())
+    {
+        if (array == nullptr || array->empty())
+            return nullptr;
+        return array->front().ptr();
+    }
 }
 
 namespace SceneUtil
@@ -50,6 +59,7 @@ RigGeometry::RigGeometry(const RigGeometry &copy, const osg::CopyOp &copyop)
     , mInfluenceMap(copy.mInfluenceMap)
     , mBone2VertexVector(copy.mBone2VertexVector)
     , mBoneSphereVector(copy.mBoneSphereVector)
+    , mPackedInfluences(copy.mPackedInfluences)
     , mLastFrameNumber(0)
     , mBoundsFirstFrame(true)
 {
@@ -216,40 +226,45 @@ void RigGeometry::cull(osg::NodeVisitor* nv)
     osg::Vec3Array* normalDst = static_cast<osg::Vec3Array*>(geom.getNormalArray());
     osg::Vec4Array* tangentDst = static_cast<osg::Vec4Array*>(geom.getTexCoordArray(7));
 
-    int index = mBoneSphereVector->mData.size();
-    for (auto &pair : mBone2VertexVector->mData)
+    SkinningArrays arrays;
+    arrays.mPositionSrc = getData(positionSrc);
+    arrays.mPositionDst = getData(positionDst);
+    if (normalDst)
+    {
+        arrays.mNormalSrc = getData(normalSrc);
+        arrays.mNormalDst = getData(normalDst);
+    }
+    if (tangentDst)
+    {
+        arrays.mTangentSrc = getData(tangentSrc);
+        arrays.mTangentDst = getData(tangentDst);
+    }
+
+    const PackedInfluences& influences = *mPackedInfluences;
+    std::size_t index = mBoneSphereVector->mData.size();
+    std::size_t weight = 0;
+    std::size_t vertex = 0;
+    for (const auto& [weightsEnd, verticesEnd] : influences.mGroupEnds)
     {
         osg::Matrixf resultMat (0, 0, 0, 0,
                                 0, 0, 0, 0,
                                 0, 0, 0, 0,
                                 0, 0, 0, 1);
 
-        for (auto &weight : pair.first)
+        for (; weight < weightsEnd; ++weight, ++index)
         {
             Bone* bone = mBoneNodesVector[index];
             if (bone == nullptr)
                 continue;
 
-            accumulateMatrix(weight.first.second, bone->mMatrixInSkeletonSpace, weight.second, resultMat);
-            index++;
+            accumulateMatrix(influences.mInvBindMatrices[weight], bone->mMatrixInSkeletonSpace, influences.mWeights[weight], resultMat);
         }
 
         if (mGeomToSkelMatrix)
             resultMat *= (*mGeomToSkelMatrix);
 
-        for (auto &vertex : pair.second)
-        {
-            (*positionDst)[vertex] = resultMat.preMult((*positionSrc)[vertex]);
-            if (normalDst)
-                (*normalDst)[vertex] = osg::Matrixf::transform3x3((*normalSrc)[vertex], resultMat);
-
-            if (tangentDst)
-            {
-                const osg::Vec4f& srcTangent = (*tangentSrc)[vertex];
-                osg::Vec3f transformedTangent = osg::Matrixf::transform3x3(osg::Vec3f(srcTangent.x(), srcTangent.y(), srcTangent.z()), resultMat);
-                (*tangentDst)[vertex] = osg::Vec4f(transformedTangent, srcTangent.w());
-            }
-        }
+        skinVertices(resultMat.ptr(), influences.mVertices.data() + vertex, verticesEnd - vertex, arrays);
+        vertex = verticesEnd;
     }
 
     positionDst->dirty();
@@ -377,6 +392,19 @@ void RigGeometry::setInfluenceMap(osg::ref_ptr<InfluenceMap> influenceMap)
 
     mBone2VertexVector->mData.reserve(bone2VertexMap.size());
     mBone2VertexVector->mData.assign(bone2VertexMap.begin(), bone2VertexMap.end());
+
+    mPackedInfluences = new PackedInfluences;
+    mPackedInfluences->mGroupEnds.reserve(mBone2VertexVector->mData.size());
+    for (const auto& [weights, vertices] : mBone2VertexVector->mData)
+    {
+        for (const auto& [boneBindMatrix, boneWeight] : weights)
+        {
+            mPackedInfluences->mInvBindMatrices.push_back(boneBindMatrix.second);
+            mPackedInfluences->mWeights.push_back(boneWeight);
+        }
+        mPackedInfluences->mVertices.insert(mPackedInfluences->mVertices.end(), vertices.begin(), vertices.end());
+        mPackedInfluences->mGroupEnds.emplace_back(mPackedInfluences->mWeights.size(), mPackedInfluences->mVertices.size());
+    }
 }
 
 void RigGeometry::accept(osg::NodeVisitor &nv)
@@ -100,6 +100,17 @@ namespace SceneUtil
         };
         osg::ref_ptr<Bone2VertexVector> mBone2VertexVector;
 
+        /// mBone2VertexVector packed into flat arrays for skinning.
+        struct PackedInfluences : public osg::Referenced
+        {
+            std::vector<osg::Matrixf> mInvBindMatrices;
+            std::vector<float> mWeights;
+            std::vector<unsigned short> mVertices;
+            // <end of weights, end of vertices> for each group
+            std::vector<std::pair<std::size_t, std::size_t>> mGroupEnds;
+        };
+        osg::ref_ptr<PackedInfluences> mPackedInfluences;
+
         struct BoneSphereVector : public osg::Referenced
         {
             std::vector<std::pair<std::string, osg::BoundingSpheref>> mData;
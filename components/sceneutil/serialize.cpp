@@ -1,8 +1,14 @@
 #include "serialize.hpp"
 
+#include <osgDB/InputStream>
 #include <osgDB/ObjectWrapper>
+#include <osgDB/OutputStream>
 #include <osgDB/Registry>
 
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
 #include <components/nifosg/matrixtransform.hpp>
 
 #include <components/sceneutil/positionattitudetransform.hpp>
@@ -95,12 +101,39 @@ public:
     }
 };
 
+static bool checkTransformation(const NifOsg::MatrixTransform&)
+{
+    return true;
+}
+
+// The matrix is written by the osg::MatrixTransform serializer, set the decomposed components directly to not modify it
+static bool readTransformation(osgDB::InputStream& is, NifOsg::MatrixTransform& node)
+{
+    is >> node.mScale;
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            is >> node.mRotationScale.mValues[i][j];
+    return true;
+}
+
+static bool writeTransformation(osgDB::OutputStream& os, const NifOsg::MatrixTransform& node)
+{
+    os << node.mScale;
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            os << node.mRotationScale.mValues[i][j];
+    os << std::endl;
+    return true;
+}
+
 class MatrixTransformSerializer : public osgDB::ObjectWrapper
 {
 public:
     MatrixTransformSerializer()
         : osgDB::ObjectWrapper(createInstanceFunc<NifOsg::MatrixTransform>, "NifOsg::MatrixTransform", "osg::Object osg::Node osg::Group osg::Transform osg::MatrixTransform NifOsg::MatrixTransform")
     {
+        addSerializer(new osgDB::UserSerializer<NifOsg::MatrixTransform>(
+            "Transformation", &checkTransformation, &readTransformation, &writeTransformation), osgDB::BaseSerializer::RW_USER);
     }
 };
 
@@ -118,11 +151,38 @@ public:
     }
 };
 
+static std::atomic_bool sGeometryDataSerialized {true};
+
+static std::shared_mutex sGeometrySerializerMutex;
+
+void registerCacheSerializers()
+{
+    static const bool done = []
+    {
+        osgDB::ObjectWrapperManager* mgr = osgDB::Registry::instance()->getObjectWrapperManager();
+        mgr->addWrapper(new MatrixTransformSerializer);
+        return true;
+    }();
+    (void) done;
+}
+
+bool isGeometryDataSerialized()
+{
+    return sGeometryDataSerialized;
+}
+
+std::shared_lock<std::shared_mutex> lockGeometrySerializer()
+{
+    return std::shared_lock(sGeometrySerializerMutex);
+}
+
 void registerSerializers()
 {
     static bool done = false;
     if (!done)
     {
+        registerCacheSerializers();
+
         osgDB::ObjectWrapperManager* mgr = osgDB::Registry::instance()->getObjectWrapperManager();
         mgr->addWrapper(new PositionAttitudeTransformSerializer);
         mgr->addWrapper(new SkeletonSerializer);
@@ -132,11 +192,14 @@ void registerSerializers()
         mgr->addWrapper(new MorphGeometrySerializer);
         mgr->addWrapper(new LightManagerSerializer);
         mgr->addWrapper(new CameraRelativeTransformSerializer);
-        mgr->addWrapper(new MatrixTransformSerializer);
 
         // Don't serialize Geometry data as we are more interested in the overall structure rather than tons of vertex data that would make the file large and hard to read.
-        mgr->removeWrapper(mgr->findWrapper("osg::Geometry"));
-        mgr->addWrapper(new GeometrySerializer);
+        {
+            const std::unique_lock lock(sGeometrySerializerMutex);
+            sGeometryDataSerialized = false;
+            mgr->removeWrapper(mgr->findWrapper("osg::Geometry"));
+            mgr->addWrapper(new GeometrySerializer);
+        }
 
         // ignore the below for now to avoid warning spam
         const char* ignore[] = {
@@ -1,12 +1,26 @@
 #ifndef OPENMW_COMPONENTS_SCENEUTIL_SERIALIZE_H
 #define OPENMW_COMPONENTS_SCENEUTIL_SERIALIZE_H
 
+#include <shared_mutex>
+
 namespace SceneUtil
 {
 
     /// Register osg node serializers for certain SceneUtil classes if not already done so
+    /// @note Replaces osg::Geometry serializer by one that does not write geometry data, so written scenes can't be read back.
     void registerSerializers();
 
+    /// Register serializers keeping all data of the NifOsg classes that can be stored in the model cache if not already done so
+    /// @note Thread safe.
+    void registerCacheSerializers();
+
+    /// @return false if registerSerializers was called and osg::Geometry data is not written anymore
+    bool isGeometryDataSerialized();
+
+    /// Keeps registerSerializers from replacing osg::Geometry serializer while the lock is held, so the result of
+    /// isGeometryDataSerialized stays valid for reading and writing scenes done under it.
+    std::shared_lock<std::shared_mutex> lockGeometrySerializer();
+
 }
 
 #endif
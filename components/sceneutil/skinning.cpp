@@ -0,0 +1,139 @@
+#include "skinning.hpp"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define OPENMW_SKINNING_SSE
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define OPENMW_SKINNING_NEON
+#endif
+
+namespace SceneUtil
+{
+    namespace
+    {
+#if defined(OPENMW_SKINNING_SSE)
+        struct Rows
+        {
+            __m128 mRow[4];
+
+            explicit Rows(const float* matrix)
+                : mRow {_mm_loadu_ps(matrix), _mm_loadu_ps(matrix + 4), _mm_loadu_ps(matrix + 8), _mm_loadu_ps(matrix + 12)}
+            {}
+        };
+
+        inline __m128 transform3x3(const Rows& rows, const float* src)
+        {
+            return _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(rows.mRow[0], _mm_set1_ps(src[0])), _mm_mul_ps(rows.mRow[1], _mm_set1_ps(src[1]))),
+                _mm_mul_ps(rows.mRow[2], _mm_set1_ps(src[2])));
+        }
+
+        inline __m128 transform(const Rows& rows, const float* src)
+        {
+            return _mm_add_ps(transform3x3(rows, src), rows.mRow[3]);
+        }
+
+        inline void store3(__m128 value, float* dst)
+        {
+            // Neighbouring vertices may belong to another influence group, so never write the 4th lane
+            _mm_storel_pi(reinterpret_cast<__m64*>(dst), value);
+            _mm_store_ss(dst + 2, _mm_movehl_ps(value, value));
+        }
+#elif defined(OPENMW_SKINNING_NEON)
+        struct Rows
+        {
+            float32x4_t mRow[4];
+
+            explicit Rows(const float* matrix)
+                : mRow {vld1q_f32(matrix), vld1q_f32(matrix + 4), vld1q_f32(matrix + 8), vld1q_f32(matrix + 12)}
+            {}
+        };
+
+        inline float32x4_t transform3x3(const Rows& rows, const float* src)
+        {
+            return vmlaq_n_f32(vmlaq_n_f32(vmulq_n_f32(rows.mRow[0], src[0]), rows.mRow[1], src[1]),
+                rows.mRow[2], src[2]);
+        }
+
+        inline float32x4_t transform(const Rows& rows, const float* src)
+        {
+            return vaddq_f32(transform3x3(rows, src), rows.mRow[3]);
+        }
+
+        inline void store3(float32x4_t value, float* dst)
+        {
+            vst1_f32(dst, vget_low_f32(value));
+            dst[2] = vgetq_lane_f32(value, 2);
+        }
+#else
+        struct Vec3
+        {
+            float mValue[3];
+        };
+
+        struct Rows
+        {
+            const float* mMatrix;
+
+            explicit Rows(const float* matrix) : mMatrix(matrix) {}
+        };
+
+        inline Vec3 transform3x3(const Rows& rows, const float* src)
+        {
+            const float* m = rows.mMatrix;
+            return Vec3 {{
+                m[0] * src[0] + m[4] * src[1] + m[8] * src[2],
+                m[1] * src[0] + m[5] * src[1] + m[9] * src[2],
+                m[2] * src[0] + m[6] * src[1] + m[10] * src[2],
+            }};
+        }
+
+        inline Vec3 transform(const Rows& rows, const float* src)
+        {
+            Vec3 result = transform3x3(rows, src);
+            for (int i = 0; i < 3; ++i)
+                result.mValue[i] += rows.mMatrix[12 + i];
+            return result;
+        }
+
+        inline void store3(const Vec3& value, float* dst)
+        {
+            for (int i = 0; i < 3; ++i)
+                dst[i] = value.mValue[i];
+        }
+#endif
+    }
+
+    void skinVertices(const float* matrix, const unsigned short* indices, std::size_t count,
+        const SkinningArrays& arrays)
+    {
+        const Rows rows(matrix);
+
+        // Each attribute is processed in a separate pass to keep the loops short and free of branches
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::size_t offset = static_cast<std::size_t>(indices[i]) * 3;
+            store3(transform(rows, arrays.mPositionSrc + offset), arrays.mPositionDst + offset);
+        }
+
+        if (arrays.mNormalDst != nullptr)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const std::size_t offset = static_cast<std::size_t>(indices[i]) * 3;
+                store3(transform3x3(rows, arrays.mNormalSrc + offset), arrays.mNormalDst + offset);
+            }
+        }
+
+        if (arrays.mTangentDst != nullptr)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const std::size_t offset = static_cast<std::size_t>(indices[i]) * 4;
+                store3(transform3x3(rows, arrays.mTangentSrc + offset), arrays.mTangentDst + offset);
+                arrays.mTangentDst[offset + 3] = arrays.mTangentSrc[offset + 3];
+            }
+        }
+    }
+}
@@ -0,0 +1,27 @@
+#ifndef OPENMW_COMPONENTS_SCENEUTIL_SKINNING_H
+#define OPENMW_COMPONENTS_SCENEUTIL_SKINNING_H
+
+#include <cstddef>
+
+namespace SceneUtil
+{
+    /// Vertex arrays used for skinning. Positions and normals are packed as 3 floats per vertex, tangents as 4
+    /// floats per vertex. Normals and tangents are optional.
+    struct SkinningArrays
+    {
+        const float* mPositionSrc = nullptr;
+        float* mPositionDst = nullptr;
+        const float* mNormalSrc = nullptr;
+        float* mNormalDst = nullptr;
+        const float* mTangentSrc = nullptr;
+        float* mTangentDst = nullptr;
+    };
+
+    /// Transform vertices with given indices by an affine matrix in osg::Matrixf layout (row-major, vectors are
+    /// multiplied from the left). Normals and tangents are transformed by the 3x3 part only, tangent w is copied.
+    /// Uses SSE or NEON when available.
+    void skinVertices(const float* matrix, const unsigned short* indices, std::size_t count,
+        const SkinningArrays& arrays);
+}
+
+#endif
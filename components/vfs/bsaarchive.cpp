@@ -7,10 +7,10 @@
 namespace VFS
 {
 
-BsaArchive::BsaArchive(const std::string &filename)
+BsaArchive::BsaArchive(const std::string &filename, bool memoryMapped)
 {
     mFile = std::make_unique<Bsa::BSAFile>();
-    mFile->open(filename);
+    mFile->open(filename, memoryMapped);
 
     const Bsa::BSAFile::FileList &filelist = mFile->getList();
     for(Bsa::BSAFile::FileList::const_iterator it = filelist.begin();it != filelist.end();++it)
@@ -68,11 +68,13 @@ Files::IStreamPtr BsaArchiveFile::open()
     return mFile->getFile(mInfo);
 }
 
-CompressedBsaArchive::CompressedBsaArchive(const std::string &filename)
+CompressedBsaArchive::CompressedBsaArchive(const std::string &filename, bool memoryMapped,
+    std::shared_ptr<Bsa::DecompressedFileCache> cache)
     : Archive()
 {
     mCompressedFile = std::make_unique<Bsa::CompressedBSAFile>();
-    mCompressedFile->open(filename);
+    mCompressedFile->open(filename, memoryMapped);
+    mCompressedFile->setCache(std::move(cache));
 
     const Bsa::BSAFile::FileList &filelist = mCompressedFile->getList();
     for(Bsa::BSAFile::FileList::const_iterator it = filelist.begin();it != filelist.end();++it)
@@ -6,6 +6,8 @@
 #include <components/bsa/bsa_file.hpp>
 #include <components/bsa/compressedbsafile.hpp>
 
+#include <memory>
+
 namespace VFS
 {
     class BsaArchiveFile : public File
@@ -38,7 +40,7 @@ namespace VFS
     class BsaArchive : public Archive
     {
     public:
-        BsaArchive(const std::string& filename);
+        BsaArchive(const std::string& filename, bool memoryMapped = false);
         BsaArchive();
         virtual ~BsaArchive();
         void listResources(std::map<std::string, File*>& out, char (*normalize_function) (char)) override;
@@ -53,7 +55,8 @@ namespace VFS
     class CompressedBsaArchive : public Archive
     {
     public:
-        CompressedBsaArchive(const std::string& filename);
+        CompressedBsaArchive(const std::string& filename, bool memoryMapped = false,
+            std::shared_ptr<Bsa::DecompressedFileCache> cache = nullptr);
         virtual ~CompressedBsaArchive() {}
         void listResources(std::map<std::string, File*>& out, char (*normalize_function) (char)) override;
         bool contains(const std::string& file, char (*normalize_function) (char)) const override;
@@ -1,8 +1,9 @@
 #include "filesystemarchive.hpp"
 
 #include <algorithm>
-
+#include <cstring>
 #include <filesystem>
+#include <fstream>
 
 #include <components/debug/debuglog.hpp>
 #include <components/files/constrainedfilestream.hpp>
@@ -10,9 +11,48 @@
 namespace VFS
 {
 
-    FileSystemArchive::FileSystemArchive(const std::string &path)
+    namespace
+    {
+        constexpr char sIndexCacheMagic[8] = {'O', 'M', 'W', 'V', 'F', 'S', 'I', 'X'};
+        constexpr std::uint32_t sIndexCacheVersion = 1;
+
+        template <class T>
+        void writeValue(std::ostream& stream, T value)
+        {
+            stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        void writeString(std::ostream& stream, const std::string& value)
+        {
+            writeValue(stream, static_cast<std::uint64_t>(value.size()));
+            stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+        }
+
+        template <class T>
+        bool readValue(std::istream& stream, T& value)
+        {
+            return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(value)));
+        }
+
+        bool readString(std::istream& stream, std::string& value)
+        {
+            std::uint64_t size = 0;
+            if (!readValue(stream, size) || size > 65536)
+                return false;
+            value.resize(static_cast<std::size_t>(size));
+            return static_cast<bool>(stream.read(value.data(), static_cast<std::streamsize>(size)));
+        }
+
+        std::int64_t getLastWriteTime(const std::filesystem::path& path, std::error_code& ec)
+        {
+            return static_cast<std::int64_t>(std::filesystem::last_write_time(path, ec).time_since_epoch().count());
+        }
+    }
+
+    FileSystemArchive::FileSystemArchive(const std::string &path, const std::string& indexCachePath)
         : mBuiltIndex(false)
         , mPath(path)
+        , mIndexCachePath(indexCachePath)
     {
 
     }
@@ -21,23 +61,22 @@ namespace VFS
     {
         if (!mBuiltIndex)
         {
-            typedef std::filesystem::recursive_directory_iterator directory_iterator;
-
-            directory_iterator end;
+            Listing listing;
+            if (mIndexCachePath.empty() || !readIndexCache(listing))
+            {
+                listing = listDirectories();
+                if (!mIndexCachePath.empty())
+                    writeIndexCache(listing);
+            }
 
             size_t prefix = mPath.size ();
 
             if (mPath.size () > 0 && mPath [prefix - 1] != '\\' && mPath [prefix - 1] != '/')
                 ++prefix;
 
-            for (directory_iterator i (std::filesystem::u8path(mPath)); i != end; ++i)
+            for (const std::string& proper : listing.mFiles)
             {
-                if(std::filesystem::is_directory (*i))
-                    continue;
-
-                auto proper = i->path ().u8string ();
-
-                FileSystemArchiveFile file(std::string((char*)proper.c_str(), proper.size()));
+                FileSystemArchiveFile file(proper);
 
                 std::string searchable;
 
@@ -45,7 +84,7 @@ namespace VFS
 
                 const auto inserted = mIndex.insert(std::make_pair(searchable, file));
                 if (!inserted.second)
-                    Log(Debug::Warning) << "Warning: found duplicate file for '" << std::string((char*)proper.c_str(), proper.size()) << "', please check your file system for two files with the same name in different cases.";
+                    Log(Debug::Warning) << "Warning: found duplicate file for '" << proper << "', please check your file system for two files with the same name in different cases.";
                 else
                     out[inserted.first->first] = &inserted.first->second;
             }
@@ -60,6 +99,117 @@ namespace VFS
         }
     }
 
+    FileSystemArchive::Listing FileSystemArchive::listDirectories() const
+    {
+        typedef std::filesystem::recursive_directory_iterator directory_iterator;
+
+        Listing result;
+
+        const std::filesystem::path root = std::filesystem::u8path(mPath);
+        std::error_code ec;
+        result.mDirectories.push_back(Directory {mPath, getLastWriteTime(root, ec)});
+
+        directory_iterator end;
+
+        for (directory_iterator i (root); i != end; ++i)
+        {
+            auto proper = i->path ().u8string ();
+            std::string path((char*)proper.c_str(), proper.size());
+
+            if(std::filesystem::is_directory (*i))
+            {
+                result.mDirectories.push_back(Directory {std::move(path), getLastWriteTime(i->path(), ec)});
+                continue;
+            }
+
+            result.mFiles.push_back(std::move(path));
+        }
+
+        return result;
+    }
+
+    bool FileSystemArchive::readIndexCache(Listing& listing) const
+    {
+        std::ifstream stream(std::filesystem::u8path(mIndexCachePath), std::ios::binary);
+        if (!stream)
+            return false;
+
+        char magic[sizeof(sIndexCacheMagic)];
+        std::uint32_t version = 0;
+        std::string path;
+        if (!stream.read(magic, sizeof(magic)) || std::memcmp(magic, sIndexCacheMagic, sizeof(magic)) != 0
+            || !readValue(stream, version) || version != sIndexCacheVersion
+            || !readString(stream, path) || path != mPath)
+            return false;
+
+        // Adding, removing or renaming an entry updates the modification time of its parent directory,
+        // so the listing stays valid as long as none of the directories has changed.
+        std::uint64_t directoriesCount = 0;
+        if (!readValue(stream, directoriesCount))
+            return false;
+        for (std::uint64_t i = 0; i < directoriesCount; ++i)
+        {
+            Directory directory;
+            if (!readString(stream, directory.mPath) || !readValue(stream, directory.mLastWriteTime))
+                return false;
+            std::error_code ec;
+            if (getLastWriteTime(std::filesystem::u8path(directory.mPath), ec) != directory.mLastWriteTime || ec)
+                return false;
+            listing.mDirectories.push_back(std::move(directory));
+        }
+
+        std::uint64_t filesCount = 0;
+        if (!readValue(stream, filesCount))
+            return false;
+        for (std::uint64_t i = 0; i < filesCount; ++i)
+        {
+            std::string file;
+            if (!readString(stream, file))
+                return false;
+            listing.mFiles.push_back(std::move(file));
+        }
+
+        Log(Debug::Verbose) << "Using cached file list for " << mPath;
+
+        return true;
+    }
+
+    void FileSystemArchive::writeIndexCache(const Listing& listing) const
+    {
+        try
+        {
+            const std::filesystem::path cachePath = std::filesystem::u8path(mIndexCachePath);
+            std::filesystem::create_directories(cachePath.parent_path());
+
+            std::filesystem::path tmpPath = cachePath;
+            tmpPath += ".tmp";
+
+            {
+                std::ofstream stream(tmpPath, std::ios::binary);
+                stream.exceptions(std::ios::failbit | std::ios::badbit);
+                stream.write(sIndexCacheMagic, sizeof(sIndexCacheMagic));
+                writeValue(stream, sIndexCacheVersion);
+                writeString(stream, mPath);
+                writeValue(stream, static_cast<std::uint64_t>(listing.mDirectories.size()));
+                for (const Directory& directory : listing.mDirectories)
+                {
+                    writeString(stream, directory.mPath);
+                    writeValue(stream, directory.mLastWriteTime);
+                }
+                writeValue(stream, static_cast<std::uint64_t>(listing.mFiles.size()));
+                for (const std::string& file : listing.mFiles)
+                    writeString(stream, file);
+            }
+
+            std::filesystem::rename(tmpPath, cachePath);
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to write file list cache for " << mPath << " to " << mIndexCachePath
+                << ": " << e.what();
+        }
+    }
+
     bool FileSystemArchive::contains(const std::string& file, char (*normalize_function)(char)) const
     {
         return mIndex.find(file) != mIndex.end();
@@ -3,7 +3,9 @@
 
 #include "archive.hpp"
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace VFS
 {
@@ -25,7 +27,9 @@ namespace VFS
     class FileSystemArchive : public Archive
     {
     public:
-        FileSystemArchive(const std::string& path);
+        /// @param indexCachePath File to store the directory listing in. When the cached listing is still valid
+        /// for all directories it is used instead of walking the directory tree. Empty path disables caching.
+        FileSystemArchive(const std::string& path, const std::string& indexCachePath = {});
 
         void listResources(std::map<std::string, File*>& out, char (*normalize_function) (char)) override;
 
@@ -39,7 +43,25 @@ namespace VFS
 
         bool mBuiltIndex;
         std::string mPath;
+        std::string mIndexCachePath;
 
+        struct Directory
+        {
+            std::string mPath;
+            std::int64_t mLastWriteTime;
+        };
+
+        struct Listing
+        {
+            std::vector<Directory> mDirectories;
+            std::vector<std::string> mFiles;
+        };
+
+        Listing listDirectories() const;
+
+        bool readIndexCache(Listing& listing) const;
+
+        void writeIndexCache(const Listing& listing) const;
     };
 
 }
@@ -4,6 +4,7 @@
 #include <istream>
 #include <algorithm>
 
+#include <components/misc/parallelfor.hpp>
 #include <components/misc/strings/lower.hpp>
 
 #include "archive.hpp"
@@ -21,10 +22,14 @@ namespace
         return ch == '\\' ? '/' : Misc::StringUtils::toLower(ch);
     }
 
+    VFS::NormalizeCharFunction get_normalize_char(bool strict)
+    {
+        return strict ? &strict_normalize_char : &nonstrict_normalize_char;
+    }
+
     void normalize_path(std::string& path, bool strict)
     {
-        char (*normalize_char)(char) = strict ? &strict_normalize_char : &nonstrict_normalize_char;
-        std::transform(path.begin(), path.end(), path.begin(), normalize_char);
+        std::transform(path.begin(), path.end(), path.begin(), get_normalize_char(strict));
     }
 
 }
@@ -42,7 +47,7 @@ namespace VFS
 
     void Manager::reset()
     {
-        mIndex.clear();
+        mIndex = PathIndex();
         mArchives.clear();
     }
 
@@ -53,34 +58,48 @@ namespace VFS
 
     void Manager::buildIndex()
     {
-        mIndex.clear();
+        if (mArchives.empty())
+        {
+            mIndex = PathIndex();
+            return;
+        }
+
+        std::vector<std::map<std::string, File*>> listed(mArchives.size());
 
-        for (const auto& archive : mArchives)
-            archive->listResources(mIndex, mStrict ? &strict_normalize_char : &nonstrict_normalize_char);
+        Misc::parallelFor(mArchives.size(), [&] (std::size_t i)
+        {
+            mArchives[i]->listResources(listed[i], get_normalize_char(mStrict));
+        });
+
+        // Last added archive has the highest priority, merge keeps already present keys
+        std::map<std::string, File*> files = std::move(listed.back());
+        for (auto it = std::next(listed.rbegin()); it != listed.rend(); ++it)
+            files.merge(*it);
+
+        mIndex = PathIndex(std::move(files));
     }
 
-    Files::IStreamPtr Manager::get(std::string_view name) const
+    File* Manager::find(std::string_view name) const
     {
-        std::string normalized(name);
-        normalize_path(normalized, mStrict);
+        return mIndex.find(name, get_normalize_char(mStrict));
+    }
 
-        return getNormalized(normalized);
+    Files::IStreamPtr Manager::get(std::string_view name) const
+    {
+        File* const file = find(name);
+        if (file == nullptr)
+            throw std::runtime_error("Resource '" + normalizeFilename(name) + "' not found");
+        return file->open();
     }
 
-    Files::IStreamPtr Manager::getNormalized(const std::string &normalizedName) const
+    Files::IStreamPtr Manager::getNormalized(std::string_view normalizedName) const
     {
-        std::map<std::string, File*>::const_iterator found = mIndex.find(normalizedName);
-        if (found == mIndex.end())
-            throw std::runtime_error("Resource '" + normalizedName + "' not found");
-        return found->second->open();
+        return get(normalizedName);
     }
 
     bool Manager::exists(std::string_view name) const
     {
-        std::string normalized(name);
-        normalize_path(normalized, mStrict);
-
-        return mIndex.find(normalized) != mIndex.end();
+        return find(name) != nullptr;
     }
 
     std::string Manager::normalizeFilename(std::string_view name) const
@@ -96,7 +115,7 @@ namespace VFS
         normalize_path(normalized, mStrict);
         for(auto it = mArchives.rbegin(); it != mArchives.rend(); ++it)
         {
-            if((*it)->contains(normalized, mStrict ? &strict_normalize_char : &nonstrict_normalize_char))
+            if((*it)->contains(normalized, get_normalize_char(mStrict)))
                 return (*it)->getDescription();
         }
         return {};
@@ -104,13 +123,10 @@ namespace VFS
 
     std::string Manager::getAbsoluteFileName(std::string_view name) const
     {
-        std::string normalized(name);
-        normalize_path(normalized, mStrict);
-
-        std::map<std::string, File*>::const_iterator found = mIndex.find(normalized);
-        if (found == mIndex.end())
-            throw std::runtime_error("Resource '" + normalized + "' not found");
-        return found->second->getPath();
+        File* const file = find(name);
+        if (file == nullptr)
+            throw std::runtime_error("Resource '" + normalizeFilename(name) + "' not found");
+        return file->getPath();
     }
 
     namespace
@@ -123,13 +139,19 @@ namespace VFS
 
     Manager::RecursiveDirectoryRange Manager::getRecursiveDirectoryIterator(std::string_view path) const
     {
+        const PathIndex::Entries& entries = mIndex.getEntries();
         if (path.empty())
-            return { mIndex.begin(), mIndex.end() };
+            return { entries.begin(), entries.end() };
         auto normalized = normalizeFilename(path);
-        const auto it = mIndex.lower_bound(normalized);
-        if (it == mIndex.end() || !startsWith(it->first, normalized))
+        const auto lowerBound = [&] (const std::string& value)
+        {
+            return std::lower_bound(entries.begin(), entries.end(), value,
+                [] (const PathIndex::Entry& entry, const std::string& v) { return entry.first < v; });
+        };
+        const auto it = lowerBound(normalized);
+        if (it == entries.end() || !startsWith(it->first, normalized))
             return { it, it };
         ++normalized.back();
-        return { it, mIndex.lower_bound(normalized) };
+        return { it, lowerBound(normalized) };
     }
 }
@@ -3,6 +3,8 @@
 
 #include <components/files/istreamptr.hpp>
 
+#include "pathindex.hpp"
+
 #include <vector>
 #include <map>
 #include <memory>
@@ -37,14 +39,14 @@ namespace VFS
         class RecursiveDirectoryIterator
         {
         public:
-            RecursiveDirectoryIterator(std::map<std::string, File*>::const_iterator it) : mIt(it) {}
+            RecursiveDirectoryIterator(PathIndex::Entries::const_iterator it) : mIt(it) {}
             const std::string& operator*() const { return mIt->first; }
             const std::string* operator->() const { return &mIt->first; }
             bool operator!=(const RecursiveDirectoryIterator& other) { return mIt != other.mIt; }
             RecursiveDirectoryIterator& operator++() { ++mIt; return *this; }
 
         private:
-            std::map<std::string, File*>::const_iterator mIt;
+            PathIndex::Entries::const_iterator mIt;
         };
 
         using RecursiveDirectoryRange = IteratorPair<RecursiveDirectoryIterator>;
@@ -63,6 +65,7 @@ namespace VFS
         void addArchive(std::unique_ptr<Archive>&& archive);
 
         /// Build the file index. Should be called when all archives have been registered.
+        /// @note Archives are listed concurrently, so listResources of different archives must not share state.
         void buildIndex();
 
         /// Does a file with this name exist?
@@ -81,7 +84,7 @@ namespace VFS
         /// Retrieve a file by name (name is already normalized).
         /// @note Throws an exception if the file can not be found.
         /// @note May be called from any thread once the index has been built.
-        Files::IStreamPtr getNormalized(const std::string& normalizedName) const;
+        Files::IStreamPtr getNormalized(std::string_view normalizedName) const;
 
         std::string getArchive(std::string_view name) const;
 
@@ -101,7 +104,9 @@ namespace VFS
 
         std::vector<std::unique_ptr<Archive>> mArchives;
 
-        std::map<std::string, File*> mIndex;
+        PathIndex mIndex;
+
+        File* find(std::string_view name) const;
     };
 
 }
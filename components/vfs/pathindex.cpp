@@ -0,0 +1,77 @@
+#include "pathindex.hpp"
+
+#include <algorithm>
+
+namespace VFS
+{
+    namespace
+    {
+        std::size_t getCapacity(std::size_t size)
+        {
+            // Keep load factor at most 0.5 to have short probe sequences
+            std::size_t result = 16;
+            while (result < size * 2)
+                result *= 2;
+            return result;
+        }
+
+        bool equal(std::string_view normalized, std::string_view name, NormalizeCharFunction normalize)
+        {
+            return normalized.size() == name.size()
+                && std::equal(normalized.begin(), normalized.end(), name.begin(),
+                    [&] (char l, char r) { return l == normalize(r); });
+        }
+    }
+
+    PathIndex::PathIndex(std::map<std::string, File*>&& files)
+    {
+        mEntries.reserve(files.size());
+        while (!files.empty())
+        {
+            auto node = files.extract(files.begin());
+            mEntries.emplace_back(std::move(node.key()), node.mapped());
+        }
+
+        mSlots.resize(getCapacity(mEntries.size()));
+        const std::size_t mask = mSlots.size() - 1;
+        for (std::size_t i = 0; i < mEntries.size(); ++i)
+        {
+            const std::uint64_t value = hash(mEntries[i].first, [] (char c) { return c; });
+            std::size_t position = static_cast<std::size_t>(value) & mask;
+            while (mSlots[position].mEntry != sEmpty)
+                position = (position + 1) & mask;
+            mSlots[position] = Slot {value, static_cast<std::uint32_t>(i)};
+        }
+    }
+
+    File* PathIndex::find(std::string_view name, NormalizeCharFunction normalize) const
+    {
+        if (mSlots.empty())
+            return nullptr;
+        const std::uint64_t value = hash(name, normalize);
+        const std::size_t mask = mSlots.size() - 1;
+        for (std::size_t position = static_cast<std::size_t>(value) & mask; ; position = (position + 1) & mask)
+        {
+            const Slot& slot = mSlots[position];
+            if (slot.mEntry == sEmpty)
+                return nullptr;
+            if (slot.mHash != value)
+                continue;
+            const Entry& entry = mEntries[slot.mEntry];
+            if (equal(entry.first, name, normalize))
+                return entry.second;
+        }
+    }
+
+    std::uint64_t PathIndex::hash(std::string_view name, NormalizeCharFunction normalize)
+    {
+        // FNV-1a
+        std::uint64_t result = 0xcbf29ce484222325ull;
+        for (char c : name)
+        {
+            result ^= static_cast<unsigned char>(normalize(c));
+            result *= 0x00000100000001B3ull;
+        }
+        return result;
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef OPENMW_COMPONENTS_VFS_PATHINDEX_H
+#define OPENMW_COMPONENTS_VFS_PATHINDEX_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace VFS
+{
+    class File;
+
+    using NormalizeCharFunction = char (*)(char);
+
+    /// @brief Immutable index of normalized file paths.
+    /// @par Lookups go through an open addressing hash table storing the path hashes, paths themselves are only
+    /// compared on a hash match. Entries are also kept in a contiguous array sorted by path for ordered iteration.
+    class PathIndex
+    {
+    public:
+        using Entry = std::pair<std::string, File*>;
+        using Entries = std::vector<Entry>;
+
+        PathIndex() = default;
+
+        /// @param files Normalized paths with the files they resolve to.
+        explicit PathIndex(std::map<std::string, File*>&& files);
+
+        /// Find a file by a name normalized on the fly with the given function.
+        /// @note Does not allocate.
+        File* find(std::string_view name, NormalizeCharFunction normalize) const;
+
+        /// All entries sorted by path.
+        const Entries& getEntries() const { return mEntries; }
+
+        std::size_t size() const { return mEntries.size(); }
+
+        static std::uint64_t hash(std::string_view name, NormalizeCharFunction normalize);
+
+    private:
+        static constexpr std::uint32_t sEmpty = static_cast<std::uint32_t>(-1);
+
+        struct Slot
+        {
+            std::uint64_t mHash = 0;
+            std::uint32_t mEntry = sEmpty;
+        };
+
+        Entries mEntries;
+        std::vector<Slot> mSlots;
+    };
+}
+
+#endif
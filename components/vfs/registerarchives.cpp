@@ -1,10 +1,17 @@
 #include "registerarchives.hpp"
 
+#include <array>
+#include <cstdint>
 #include <set>
+#include <cstdio>
 #include <filesystem>
+#include <sstream>
 #include <stdexcept>
 
+#include <components/bsa/decompressedfilecache.hpp>
 #include <components/debug/debuglog.hpp>
+#include <components/files/hash.hpp>
+#include <components/misc/parallelfor.hpp>
 
 #include <components/vfs/manager.hpp>
 #include <components/vfs/bsaarchive.hpp>
@@ -12,24 +19,33 @@
 
 namespace VFS
 {
+    namespace
+    {
+        std::string getIndexCacheFileName(const std::string& dataDir)
+        {
+            // Name has to be the same for the same directory across builds and platforms
+            std::istringstream stream(dataDir);
+            const std::array<std::uint64_t, 2> hash = Files::getHash(dataDir, stream);
+            char name[64];
+            std::snprintf(name, sizeof(name), "data-%016llx%016llx.idx",
+                static_cast<unsigned long long>(hash[0]), static_cast<unsigned long long>(hash[1]));
+            return name;
+        }
+    }
 
-    void registerArchives(VFS::Manager *vfs, const Files::Collections &collections, const std::vector<std::string> &archives, bool useLooseFiles)
+    void registerArchives(VFS::Manager *vfs, const Files::Collections &collections, const std::vector<std::string> &archives, bool useLooseFiles, bool memoryMapped,
+        const std::filesystem::path& indexCacheDir, const std::shared_ptr<Bsa::DecompressedFileCache>& decompressedCache)
     {
         const Files::PathContainer& dataDirs = collections.getPaths();
 
+        std::vector<std::string> archivePaths;
+        archivePaths.reserve(archives.size());
         for (std::vector<std::string>::const_iterator archive = archives.begin(); archive != archives.end(); ++archive)
         {
             if (collections.doesExist(*archive))
             {
-                // Last BSA has the highest priority
-                const std::string archivePath = collections.getPath(*archive).string();
-                Log(Debug::Info) << "Adding BSA archive " << archivePath;
-                Bsa::BsaVersion bsaVersion = Bsa::CompressedBSAFile::detectVersion(archivePath);
-
-                if (bsaVersion == Bsa::BSAVER_COMPRESSED)
-                    vfs->addArchive(std::make_unique<CompressedBsaArchive>(archivePath));
-                else
-                    vfs->addArchive(std::make_unique<BsaArchive>(archivePath));
+                archivePaths.push_back(collections.getPath(*archive).string());
+                Log(Debug::Info) << "Adding BSA archive " << archivePaths.back();
             }
             else
             {
@@ -37,6 +53,23 @@ namespace VFS
             }
         }
 
+        // Headers of different archives are independent, read them concurrently
+        std::vector<std::unique_ptr<Archive>> bsaArchives(archivePaths.size());
+        Misc::parallelFor(archivePaths.size(), [&] (std::size_t i)
+        {
+            const std::string& archivePath = archivePaths[i];
+            Bsa::BsaVersion bsaVersion = Bsa::CompressedBSAFile::detectVersion(archivePath);
+
+            if (bsaVersion == Bsa::BSAVER_COMPRESSED)
+                bsaArchives[i] = std::make_unique<CompressedBsaArchive>(archivePath, memoryMapped, decompressedCache);
+            else
+                bsaArchives[i] = std::make_unique<BsaArchive>(archivePath, memoryMapped);
+        });
+
+        // Last BSA has the highest priority
+        for (std::unique_ptr<Archive>& archive : bsaArchives)
+            vfs->addArchive(std::move(archive));
+
         if (useLooseFiles)
         {
             std::set<std::filesystem::path> seen;
@@ -47,7 +80,10 @@ namespace VFS
                 {
                     Log(Debug::Info) << "Adding data directory " << iter->string();
                     // Last data dir has the highest priority
-                    vfs->addArchive(std::make_unique<FileSystemArchive>(iter->string()));
+                    std::string indexCachePath;
+                    if (!indexCacheDir.empty())
+                        indexCachePath = (indexCacheDir / getIndexCacheFileName(iter->string())).string();
+                    vfs->addArchive(std::make_unique<FileSystemArchive>(iter->string(), indexCachePath));
                 }
                 else
                     Log(Debug::Info) << "Ignoring duplicate data directory " << iter->string();
@@ -3,13 +3,26 @@
 
 #include <components/files/collections.hpp>
 
+#include <filesystem>
+#include <memory>
+
+namespace Bsa
+{
+    class DecompressedFileCache;
+}
+
 namespace VFS
 {
     class Manager;
 
     /// @brief Register BSA and file system archives based on the given OpenMW configuration.
+    /// @param memoryMapped Map BSA archives into memory instead of opening a file for every read.
+    /// @param indexCacheDir Directory to cache data directory listings in. Empty path disables caching.
+    /// @param decompressedCache Cache of recently decompressed files shared by all compressed archives, can be null.
     void registerArchives (VFS::Manager* vfs, const Files::Collections& collections,
-        const std::vector<std::string>& archives, bool useLooseFiles);
+        const std::vector<std::string>& archives, bool useLooseFiles, bool memoryMapped = false,
+        const std::filesystem::path& indexCacheDir = {},
+        const std::shared_ptr<Bsa::DecompressedFileCache>& decompressedCache = nullptr);
 }
 
 #endif
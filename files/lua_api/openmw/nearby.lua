@@ -71,6 +71,19 @@
 --     radius = 10,
 -- })
 
+---
+-- Cast several rays at once and return the first collision of each. Works the same way as
+-- calling `castRay` for every ray, but is much faster when many rays are needed.
+-- @function [parent=#nearby] castRays
+-- @param #list<#table> rays A list of rays. Each ray is a table with fields `from` and `to` (see `castRay`)
+-- and optionally any of the options supported by `castRay` (`ignore`, `collisionType`, `radius`).
+-- @return #list<#RayCastingResult> Results in the same order as the rays.
+-- @usage local results = nearby.castRays({
+--     {from=self.position, to=pointA, ignore=self},
+--     {from=self.position, to=pointB, collisionType=nearby.COLLISION_TYPE.HeightMap},
+-- })
+-- if results[1].hit then print('obstacle between self and A') end
+
 ---
 -- Cast ray from one point to another and find the first visual intersection with anything in the scene.
 -- As opposite to `castRay` can find an intersection with an object without collisions.